@@ -409,6 +409,10 @@ void AppModel::onResetWallet()
 {
     m_walletConnections.disconnect();
 
+    assert(m_transactions);
+    assert(m_transactions.use_count() == 1);
+    m_transactions.reset();
+
     assert(m_myAssets);
     assert(m_myAssets.use_count() == 1);
     m_myAssets.reset();
@@ -623,7 +627,8 @@ void AppModel::start()
 
     m_wallet   = std::make_shared<WalletModel>(m_db, nodeAddrStr, m_walletReactor);
     m_rates    = std::make_shared<ExchangeRatesManager>(m_wallet, m_settings);
-    m_assets   = std::make_shared<AssetsManager>(m_wallet, m_rates);
+    m_transactions = std::make_shared<TransactionsStore>(m_wallet);
+    m_assets   = std::make_shared<AssetsManager>(m_wallet, m_rates, *m_transactions);
     m_myAssets = std::make_shared<AssetsList>(m_wallet, m_assets, m_rates);
 
     if (m_settings.getRunLocalNode())
@@ -686,6 +691,14 @@ AssetsList::Ptr AppModel::getMyAssets() const
     return m_myAssets;
 }
 
+TransactionsStore::Ptr AppModel::getTransactions() const
+{
+    if (m_transactions) return m_transactions;
+
+    assert(false);
+    throw std::runtime_error("getTransactions for empty transactions store");
+}
+
 WalletSettings& AppModel::getSettings() const
 {
     return m_settings;
@@ -27,6 +27,7 @@
 #include "assets_manager.h"
 #include "exchange_rates_manager.h"
 #include "assets_list.h"
+#include "transactions_store.h"
 #include <memory>
 #include <QSharedMemory>
 #include <QSystemSemaphore>
@@ -83,6 +84,7 @@ public:
     [[nodiscard]] AssetsManager::Ptr getAssets() const;
     [[nodiscard]] ExchangeRatesManager::Ptr getRates() const;
     [[nodiscard]] AssetsList::Ptr getMyAssets() const;
+    [[nodiscard]] TransactionsStore::Ptr getTransactions() const;
 
     MessageManager& getMessages();
 
@@ -134,6 +136,7 @@ private:
     ExchangeRatesManager::Ptr m_rates;
     AssetsManager::Ptr m_assets;
     AssetsList::Ptr m_myAssets; // assets in the wallet + BEAM even if 0
+    TransactionsStore::Ptr m_transactions;
     MessageManager m_messages;
     ECC::NoLeak<ECC::uintBig> m_passwordHash;
     beam::io::Reactor::Ptr m_walletReactor;
@@ -11,15 +11,97 @@
 #include "assets_list.h"
 #include "viewmodel/ui_helpers.h"
 
+namespace
+{
+    using Roles = AssetsList::Roles;
+
+    // roles grouped by the event that changes them, views re-evaluate only the affected bindings
+    QVector<int> getBalanceRoles(uint8_t fields)
+    {
+        using Field = WalletStatusSnapshot::Field;
+
+        QVector<int> roles;
+        if (fields & Field::Available)         roles.push_back(static_cast<int>(Roles::RAmount));
+        if (fields & Field::AvailableRegular)  roles.push_back(static_cast<int>(Roles::RAmountRegular));
+        if (fields & Field::AvailableShielded) roles.push_back(static_cast<int>(Roles::RAmountShielded));
+        if (fields & Field::Maturing)          roles.push_back(static_cast<int>(Roles::RMaturingRegular));
+        if (fields & Field::MaturingMP)        roles.push_back(static_cast<int>(Roles::RMaturingMP));
+        if (fields & Field::ReceivingChange)   roles.push_back(static_cast<int>(Roles::RChange));
+        if (fields & (Field::Maturing | Field::MaturingMP))
+        {
+            roles.push_back(static_cast<int>(Roles::RMaturingTotal));
+        }
+        if (fields & (Field::Maturing | Field::MaturingMP | Field::ReceivingChange))
+        {
+            roles.push_back(static_cast<int>(Roles::RLocked));
+        }
+        return roles;
+    }
+
+    const QVector<int> kRateRoles =
+    {
+        static_cast<int>(Roles::RRateUnit),
+        static_cast<int>(Roles::RRate),
+    };
+
+    const QVector<int> kMetadataRoles =
+    {
+        static_cast<int>(Roles::Search),
+        static_cast<int>(Roles::RUnitName),
+        static_cast<int>(Roles::RIcon),
+        static_cast<int>(Roles::RColor),
+        static_cast<int>(Roles::RSelectionColor),
+        static_cast<int>(Roles::RName),
+        static_cast<int>(Roles::RSmallestUnitName),
+        static_cast<int>(Roles::RShortDesc),
+        static_cast<int>(Roles::RLongDesc),
+        static_cast<int>(Roles::RSiteUrl),
+        static_cast<int>(Roles::RWhitePaper),
+        static_cast<int>(Roles::RVerified),
+    };
+
+    const QHash<int, QByteArray>& getRoleNames()
+    {
+        static const auto roles = QHash<int, QByteArray>
+        {
+            {static_cast<int>(Roles::Search),           "search"},
+            {static_cast<int>(Roles::RId),              "id"},
+            {static_cast<int>(Roles::RUnitName),        "unitName"},
+            {static_cast<int>(Roles::RAmount),          "amount"},
+            {static_cast<int>(Roles::RAmountRegular),   "amountRegular"},
+            {static_cast<int>(Roles::RAmountShielded),  "amountShielded"},
+            {static_cast<int>(Roles::RIcon),            "icon"},
+            {static_cast<int>(Roles::RColor),           "color"},
+            {static_cast<int>(Roles::RSelectionColor),  "selectionColor"},
+            {static_cast<int>(Roles::RRateUnit),        "rateUnit"},
+            {static_cast<int>(Roles::RRate),            "rate"},
+            {static_cast<int>(Roles::RChange),          "change"},
+            {static_cast<int>(Roles::RLocked),          "locked"},
+            {static_cast<int>(Roles::RMaturingRegular), "maturingRegular"},
+            {static_cast<int>(Roles::RMaturingMP),      "maturingMP"},
+            {static_cast<int>(Roles::RMaturingTotal),   "maturingTotal"},
+            {static_cast<int>(Roles::RName),            "assetName"},
+            {static_cast<int>(Roles::RSmallestUnitName),"smallestUnitName"},
+            {static_cast<int>(Roles::RShortDesc),       "shortDesc"},
+            {static_cast<int>(Roles::RLongDesc),        "longDesc"},
+            {static_cast<int>(Roles::RSiteUrl),         "siteUrl"},
+            {static_cast<int>(Roles::RWhitePaper),      "whitePaper"},
+            {static_cast<int>(Roles::RVerified),        "verified"},
+        };
+        return roles;
+    }
+}
+
 AssetsList::AssetsList(WalletModel::Ptr wallet, AssetsManager::Ptr assets, ExchangeRatesManager::Ptr rates)
     : _wallet(std::move(wallet))
     , _amgr(std::move(assets))
     , _rates(std::move(rates))
+    , _status(_wallet->getStatusSnapshot())
 {
     connect(_rates.get(),  &ExchangeRatesManager::rateUnitChanged, this,  &AssetsList::onNewRates);
     connect(_rates.get(),  &ExchangeRatesManager::activeRateChanged, this,  &AssetsList::onNewRates);
     connect(_wallet.get(), &WalletModel::walletStatusChanged, this, &AssetsList::onWalletStatus);
-    connect(_amgr.get(),   &AssetsManager::assetInfo, this,  &AssetsList::onAssetInfo);
+    connect(_amgr.get(),   &AssetsManager::assetsInfoChanged, this,  &AssetsList::onAssetsInfo);
     _wallet->getAsync()->getWalletStatus();
     // Transactions table would be created later and get this for us
     // Need to refactor multiple requests in the future
@@ -28,49 +110,23 @@ AssetsList::AssetsList(WalletModel::Ptr wallet, AssetsManager::Ptr assets, Excha
 
 QHash<int, QByteArray> AssetsList::roleNames() const
 {
-    static const auto roles = QHash<int, QByteArray>
-    {
-        {static_cast<int>(Roles::Search),           "search"},
-        {static_cast<int>(Roles::RId),              "id"},
-        {static_cast<int>(Roles::RUnitName),        "unitName"},
-        {static_cast<int>(Roles::RAmount),          "amount"},
-        {static_cast<int>(Roles::RAmountRegular),   "amountRegular"},
-        {static_cast<int>(Roles::RAmountShielded),  "amountShielded"},
-        {static_cast<int>(Roles::RIcon),            "icon"},
-        {static_cast<int>(Roles::RColor),           "color"},
-        {static_cast<int>(Roles::RSelectionColor),  "selectionColor"},
-        {static_cast<int>(Roles::RRateUnit),        "rateUnit"},
-        {static_cast<int>(Roles::RRate),            "rate"},
-        {static_cast<int>(Roles::RChange),          "change"},
-        {static_cast<int>(Roles::RLocked),          "locked"},
-        {static_cast<int>(Roles::RMaturingRegular), "maturingRegular"},
-        {static_cast<int>(Roles::RMaturingMP),      "maturingMP"},
-        {static_cast<int>(Roles::RMaturingTotal),   "maturingTotal"},
-        {static_cast<int>(Roles::RName),            "assetName"},
-        {static_cast<int>(Roles::RSmallestUnitName),"smallestUnitName"},
-        {static_cast<int>(Roles::RShortDesc),       "shortDesc"},
-        {static_cast<int>(Roles::RLongDesc),        "longDesc"},
-        {static_cast<int>(Roles::RSiteUrl),         "siteUrl"},
-        {static_cast<int>(Roles::RWhitePaper),      "whitePaper"},
-        {static_cast<int>(Roles::RVerified),        "verified"},
-    };
-    return roles;
+    return getRoleNames();
 }
 
 int AssetsList::getRoleId(QString name) const
 {
-    const auto roles = roleNames();
-    const auto byteName = name.toUtf8();
-
-    QHashIterator<int, QByteArray> iter(roles);
-    while(iter.hasNext()) {
-        iter.next();
-        if (iter.value() == byteName) {
-            return iter.key();
+    static const auto ids = []()
+    {
+        QHash<QByteArray, int> result;
+        const auto& roles = getRoleNames();
+        for (auto it = roles.begin(); it != roles.end(); ++it)
+        {
+            result.insert(it.value(), it.key());
         }
-    }
+        return result;
+    }();
 
-    return -1;
+    return ids.value(name.toUtf8(), -1);
 }
 
 QVariant AssetsList::data(const QModelIndex &index, int role) const
@@ -83,6 +139,8 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
 
     const auto& asset  = m_list[index.row()];
     const auto assetId = beam::Asset::ID(asset->id());
+    static const WalletStatusSnapshot::Balance kZero;
+    const auto& balance = _status ? _status->getBalance(assetId) : kZero;
 
     switch (static_cast<Roles>(role))
     {
@@ -91,28 +149,28 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
         case Roles::RUnitName:
             return _amgr->getUnitName(assetId, AssetsManager::NoShorten);
         case Roles::RAmount:
-            return beamui::AmountBigToUIString(_wallet->getAvailable(assetId));
+            return beamui::AmountBigToUIString(balance.available);
         case Roles::RAmountRegular:
-            return beamui::AmountBigToUIString(_wallet->getAvailableRegular(assetId));
+            return beamui::AmountBigToUIString(balance.availableRegular);
         case Roles::RAmountShielded:
-            return beamui::AmountBigToUIString(_wallet->getAvailableShielded(assetId));
+            return beamui::AmountBigToUIString(balance.availableShielded);
         case Roles::RMaturingRegular:
-            return beamui::AmountBigToUIString(_wallet->getMaturing(assetId));
+            return beamui::AmountBigToUIString(balance.maturing);
         case Roles::RMaturingMP:
-            return beamui::AmountBigToUIString(_wallet->getMatutingMP(assetId));
+            return beamui::AmountBigToUIString(balance.maturingMP);
         case Roles::RMaturingTotal:
         {
-            auto total = _wallet->getMaturing(assetId);
-            total += _wallet->getMatutingMP(assetId);
+            auto total = balance.maturing;
+            total += balance.maturingMP;
             return beamui::AmountBigToUIString(total);
         }
         case Roles::RChange:
-            return beamui::AmountBigToUIString(_wallet->getReceivingChange(assetId));
+            return beamui::AmountBigToUIString(balance.receivingChange);
         case Roles::RLocked:
         {
-             auto locked = _wallet->getMaturing(assetId);
-             locked += _wallet->getMatutingMP(assetId);
-             locked += _wallet->getReceivingChange(assetId);
+             auto locked = balance.maturing;
+             locked += balance.maturingMP;
+             locked += balance.receivingChange;
              return beamui::AmountBigToUIString(locked);
         }
         case Roles::Search:
@@ -150,60 +208,56 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
     }
 }
 
-bool AssetsList::hasAsset(beam::Asset::ID id)
+uint64_t AssetsList::getKey(const std::shared_ptr<AssetObject>& item) const
 {
-     for (auto obj: m_list)
-     {
-         if (obj->id() == id)
-         {
-             return true;
-         }
-     }
-     return false;
+    return item->id();
 }
 
-std::shared_ptr<AssetObject> AssetsList::getAsset(beam::Asset::ID id)
+bool AssetsList::hasAsset(beam::Asset::ID id)
 {
-     for (auto obj: m_list)
-     {
-         if (obj->id() == id)
-         {
-             return obj;
-         }
-     }
-     return {};
+    return contains(id);
 }
 
-bool AssetsList::touch(beam::Asset::ID id)
+std::shared_ptr<AssetObject> AssetsList::getAsset(beam::Asset::ID id)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->id() == id) {
-           const auto idx = it - m_list.begin();
-           ListModel::touch(idx);
-           return true;
-        }
-    }
-    return false;
+    const auto idx = indexOf(id);
+    return idx >= 0 ? m_list[idx] : std::shared_ptr<AssetObject>();
 }
 
 void AssetsList::onNewRates()
 {
-    touch(beam::Asset::s_BeamID);
+    // the rate unit is shown on every row and any asset may have a rate
+    if (!m_list.isEmpty())
+    {
+        emit dataChanged(createIndex(0, 0), createIndex(m_list.size() - 1, 0), kRateRoles);
+    }
 }
 
-void AssetsList::onWalletStatus()
+void AssetsList::onWalletStatus(const WalletStatusSnapshot::Ptr& status)
 {
+    _status = status;
+
     //
-    // Update/Add new assets
+    // Update/Add new assets, only the balances that moved are reported
     //
-    auto anz = _wallet->getAssetsNZ();
     std::set<beam::Asset::ID> anew;
+    ChangedRows changed;
 
-    for (auto aid: anz)
+    for (const auto& [aid, fields]: status->getChanges())
     {
-        if (!touch(aid))
+        if (const auto row = indexOf(aid); row >= 0)
         {
-            anew.insert(aid);
+            changed[getBalanceRoles(fields)].push_back(row);
+        }
+    }
+    emitDataChanged(std::move(changed));
+
+    // the list may have been created after some versions went by, check all assets
+    for (const auto& balance: status->getBalances())
+    {
+        if (!hasAsset(balance.first))
+        {
+            anew.insert(balance.first);
         }
     }
 
@@ -212,7 +266,7 @@ void AssetsList::onWalletStatus()
         std::vector<std::shared_ptr<AssetObject>> newobj;
         for (auto aid: anew)
         {
-            newobj.insert(newobj.begin(), std::make_shared<AssetObject>(aid));
+            newobj.push_back(std::make_shared<AssetObject>(aid));
         }
         reset(newobj);
         return;
@@ -234,6 +288,7 @@ void AssetsList::onWalletStatus()
     //
     // Remove old assets
     //
+    const auto& anz = status->getBalances();
     std::vector<std::shared_ptr<AssetObject>> aold;
     for (auto& ai: m_list)
     {
@@ -245,7 +300,15 @@ void AssetsList::onWalletStatus()
     remove(aold);
 }
 
-void AssetsList::onAssetInfo(beam::Asset::ID assetId)
+void AssetsList::onAssetsInfo(const QSet<beam::Asset::ID>& assets)
 {
-    touch(assetId);
+    std::vector<int> rows;
+    for (auto assetId : assets)
+    {
+        if (const int row = indexOf(assetId); row >= 0)
+        {
+            rows.push_back(row);
+        }
+    }
+    emitDataChanged(std::move(rows), kMetadataRoles);
 }
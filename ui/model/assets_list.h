@@ -17,7 +17,7 @@
 #include "wallet_model.h"
 #include "exchange_rates_manager.h"
 
-class AssetsList: public ListModel<std::shared_ptr<AssetObject>>
+class AssetsList: public ListModel<std::shared_ptr<AssetObject>, uint64_t>
 {
     Q_OBJECT
 public:
@@ -61,15 +61,18 @@ public:
 
 private slots:
     void onNewRates();
-    void onWalletStatus();
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onWalletStatus(const WalletStatusSnapshot::Ptr& status);
+    void onAssetsInfo(const QSet<beam::Asset::ID>& assets);
+
+protected:
+    [[nodiscard]] uint64_t getKey(const std::shared_ptr<AssetObject>& item) const override;
 
 private:
-    bool touch(beam::Asset::ID id);
     std::shared_ptr<AssetObject> getAsset(beam::Asset::ID id);
     bool hasAsset(beam::Asset::ID id);
 
     WalletModel::Ptr _wallet;
     AssetsManager::Ptr _amgr;
     ExchangeRatesManager::Ptr _rates;
+    WalletStatusSnapshot::Ptr _status;
 };
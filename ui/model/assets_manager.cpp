@@ -25,16 +25,41 @@ namespace
     #else
     const beam::Asset::ID BeamXID = 31;
     #endif
+
+    // asset info cannot change while the asset lock period lasts, a day of blocks
+    const beam::Height kAssetRevalidatePeriod = 1440;
+
+    bool isSameVerification(const beam::wallet::VerificationInfo& a, const beam::wallet::VerificationInfo& b)
+    {
+        return a.m_verified == b.m_verified && a.m_icon == b.m_icon && a.m_color == b.m_color;
+    }
+
+    // differs only if the asset has been re-registered or its metadata replaced
+    bool isSameAsset(const beam::wallet::WalletAsset& known, const beam::wallet::WalletAsset& received)
+    {
+        return known.m_LockHeight == received.m_LockHeight
+            && known.m_Owner == received.m_Owner
+            && known.m_Metadata.m_Value == received.m_Metadata.m_Value;
+    }
 }
 
-AssetsManager::AssetsManager(WalletModel::Ptr wallet, ExchangeRatesManager::Ptr rates)
+AssetsManager::AssetsManager(WalletModel::Ptr wallet, ExchangeRatesManager::Ptr rates, const TransactionsStore& transactions)
     : _wallet(std::move(wallet))
     , _rates(std::move(rates))
 {
+    _flushTimer.setSingleShot(true);
+    _flushTimer.setInterval(0);
+    connect(&_flushTimer, &QTimer::timeout, this, &AssetsManager::flush);
+
     connect(_wallet.get(), &WalletModel::assetInfoChanged, this, &AssetsManager::onAssetInfo);
     connect(_rates.get(),  &ExchangeRatesManager::rateUnitChanged,   this,  &AssetsManager::assetsListChanged);
     connect(_rates.get(),  &ExchangeRatesManager::activeRateChanged, this,  &AssetsManager::assetsListChanged);
     connect(_wallet.get(), &WalletModel::verificationInfoUpdate, this, &AssetsManager::onAssetVerification);
+    connect(&transactions, &TransactionsStore::transactionsChanged, this, &AssetsManager::onTransactionsChanged);
+    connect(_wallet.get(), &WalletModel::normalCoinsChanged, this, &AssetsManager::onNormalCoinsChanged);
+    #ifdef BEAM_LELANTUS_SUPPORT
+    connect(_wallet.get(), &WalletModel::shieldedCoinChanged, this, &AssetsManager::onShieldedCoinChanged);
+    #endif // BEAM_LELANTUS_SUPPORT
     _wallet->getAsync()->getVerificationInfo();
 
     _icons[0]  = "qrc:/assets/asset-0.svg";
@@ -84,43 +109,171 @@ void AssetsManager::collectAssetInfo(beam::Asset::ID assetId)
 {
     if (assetId < 1)
     {
-        emit assetInfo(assetId);
+        notifyAssetInfo(assetId);
+    }
+    else
+    {
+        requestAssetInfo(assetId);
+    }
+}
+
+void AssetsManager::requestAssetInfo(beam::Asset::ID assetId)
+{
+    // don't request info multiple times, requests made during one event loop turn go out together
+    if (_requested.insert(assetId).second)
+    {
+        _pending.insert(assetId);
+        _flushTimer.start();
+    }
+}
+
+void AssetsManager::notifyAssetInfo(beam::Asset::ID assetId)
+{
+    _presentation.erase(assetId);
+    _changed.insert(assetId);
+    _flushTimer.start();
+}
+
+void AssetsManager::prefetchAssetInfo(beam::Asset::ID assetId)
+{
+    if (assetId == beam::Asset::s_BeamID)
+    {
+        return;
+    }
+
+    if (_info.find(assetId) == _info.end())
+    {
+        requestAssetInfo(assetId);
     }
     else
     {
-        // don't request info multiple times
-        if (_requested.find(assetId) == _requested.end())
+        revalidateAssetInfo(assetId);
+    }
+}
+
+void AssetsManager::flush()
+{
+    for (auto assetId: _pending)
+    {
+        _wallet->getAsync()->getAssetInfo(assetId);
+    }
+    _pending.clear();
+
+    if (!_changed.isEmpty())
+    {
+        QSet<beam::Asset::ID> changed;
+        changed.swap(_changed);
+
+        emit assetsInfoChanged(changed);
+        emit assetsListChanged();
+    }
+}
+
+void AssetsManager::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+{
+    using namespace beam::wallet;
+
+    if (action == ChangeAction::Removed)
+    {
+        return;
+    }
+
+    // contract spends are decoded by the rows builder off the UI thread, their assets are asked for when shown
+    for (const auto& tx: items)
+    {
+        prefetchAssetInfo(tx.m_assetId);
+
+        if (tx.m_txType == TxType::DexSimpleSwap)
         {
-            _requested.insert(assetId);
-            _wallet->getAsync()->getAssetInfo(assetId);
+            if (auto rasset = tx.GetParameter<beam::Asset::ID>(TxParameterID::DexReceiveAsset))
+            {
+                prefetchAssetInfo(*rasset);
+            }
         }
     }
 }
 
+void AssetsManager::onNormalCoinsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::Coin>& utxos)
+{
+    if (action == beam::wallet::ChangeAction::Removed)
+    {
+        return;
+    }
+
+    for (const auto& coin: utxos)
+    {
+        prefetchAssetInfo(coin.m_ID.m_AssetID);
+    }
+}
+
+#ifdef BEAM_LELANTUS_SUPPORT
+void AssetsManager::onShieldedCoinChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::ShieldedCoin>& coins)
+{
+    if (action == beam::wallet::ChangeAction::Removed)
+    {
+        return;
+    }
+
+    for (const auto& coin: coins)
+    {
+        prefetchAssetInfo(coin.m_CoinID.m_AssetID);
+    }
+}
+#endif // BEAM_LELANTUS_SUPPORT
+
+void AssetsManager::revalidateAssetInfo(beam::Asset::ID assetId)
+{
+    const auto it = _validated.find(assetId);
+    if (it == _validated.end())
+    {
+        return;
+    }
+
+    // height is unknown until the wallet connects, stored info is good enough till then
+    const auto height = _wallet->getCurrentHeight();
+    if (height == 0 || (height >= it->second && height - it->second < kAssetRevalidatePeriod))
+    {
+        return;
+    }
+
+    requestAssetInfo(assetId);
+}
+
 void AssetsManager::onAssetInfo(beam::Asset::ID id, const beam::wallet::WalletAsset& asset)
 {
     _requested.erase(id);
 
     if (asset.m_ID == beam::Asset::s_InvalidID)
     {
+        _validated.erase(id);
+
         // Bad info, erase any previously stored and if we had something stored notify about change
         const auto it = _info.find(id);
         if (it != _info.end())
         {
             _info.erase(it);
-            emit assetInfo(id);
+            notifyAssetInfo(id);
         }
     }
     else
     {
+        const auto validated = asset.m_RefreshHeight ? asset.m_RefreshHeight : _wallet->getCurrentHeight();
+        _validated[id] = validated;
+
+        const auto it = _info.find(id);
+        if (it != _info.end() && isSameAsset(*it->second.first, asset))
+        {
+            // Known info confirmed, parsed metadata stays and there is nothing to repaint
+            it->second.first = std::make_shared<beam::wallet::WalletAsset>(asset);
+            return;
+        }
+
         // Good info came, save and notify about change
         AssetPtr aptr = std::make_shared<beam::wallet::WalletAsset>(asset);
         _info[id] = std::make_pair(aptr, MetaPtr());
 
-        emit assetInfo(id);
+        notifyAssetInfo(id);
     }
-
-    emit assetsListChanged();
 }
 
 AssetsManager::MetaPtr AssetsManager::getAsset(beam::Asset::ID id)
@@ -133,6 +286,8 @@ AssetsManager::MetaPtr AssetsManager::getAsset(beam::Asset::ID id)
             MetaPtr mptr = std::make_shared<beam::wallet::WalletAssetMeta>(*it->second.first);
             it->second.second = mptr;
         }
+
+        revalidateAssetInfo(id);
         return it->second.second;
     }
 
@@ -140,7 +295,7 @@ AssetsManager::MetaPtr AssetsManager::getAsset(beam::Asset::ID id)
     return MetaPtr();
  }
 
-QString AssetsManager::getIcon(beam::Asset::ID id)
+QString AssetsManager::makeIcon(beam::Asset::ID id)
 {
     if (id < 1)
     {
@@ -170,7 +325,7 @@ QString AssetsManager::getIcon(beam::Asset::ID id)
      return "qrc:/assets/asset-err.svg";
 }
 
-QString AssetsManager::getUnitName(beam::Asset::ID id, Shorten shorten)
+QString AssetsManager::makeUnitName(beam::Asset::ID id, Shorten shorten)
 {
     if (id < 1)
     {
@@ -204,7 +359,7 @@ QString AssetsManager::getUnitName(beam::Asset::ID id, Shorten shorten)
     return unitName;
 }
 
-QString AssetsManager::getName(beam::Asset::ID id)
+QString AssetsManager::makeName(beam::Asset::ID id)
 {
     if (id < 1)
     {
@@ -227,7 +382,7 @@ QString AssetsManager::getName(beam::Asset::ID id)
     return name;
 }
 
-QString AssetsManager::getSmallestUnitName(beam::Asset::ID id)
+QString AssetsManager::makeSmallestUnitName(beam::Asset::ID id)
 {
     if (id < 1)
     {
@@ -338,7 +493,7 @@ bool AssetsManager::hasAsset(beam::Asset::ID assetId) const
     return assets.find(assetId) != assets.end();
 }
 
-QColor AssetsManager::getColor(beam::Asset::ID id)
+QColor AssetsManager::makeColor(beam::Asset::ID id)
 {
     if (id < 1)
     {
@@ -376,6 +531,60 @@ QColor AssetsManager::getSelectionColor(beam::Asset::ID id)
     return getColor(id);
 }
 
+const AssetsManager::Presentation& AssetsManager::getPresentation(beam::Asset::ID id)
+{
+    if (const auto it = _presentation.find(id); it != _presentation.end())
+    {
+        return it->second;
+    }
+
+    Presentation presentation;
+    presentation.icon              = makeIcon(id);
+    presentation.color             = makeColor(id);
+    presentation.name              = makeName(id);
+    presentation.unitName          = makeUnitName(id, NoShorten);
+    presentation.unitNameShortTxt  = makeUnitName(id, ShortenTxt);
+    presentation.unitNameShortHtml = makeUnitName(id, ShortenHtml);
+    presentation.smallestUnitName  = makeSmallestUnitName(id);
+    presentation.verified          = isVerified(id);
+
+    return _presentation.emplace(id, std::move(presentation)).first->second;
+}
+
+QString AssetsManager::getIcon(beam::Asset::ID id)
+{
+    return getPresentation(id).icon;
+}
+
+QString AssetsManager::getUnitName(beam::Asset::ID id, Shorten shorten)
+{
+    const auto& presentation = getPresentation(id);
+    switch (shorten)
+    {
+    case ShortenTxt:
+        return presentation.unitNameShortTxt;
+    case ShortenHtml:
+        return presentation.unitNameShortHtml;
+    default:
+        return presentation.unitName;
+    }
+}
+
+QString AssetsManager::getName(beam::Asset::ID id)
+{
+    return getPresentation(id).name;
+}
+
+QString AssetsManager::getSmallestUnitName(beam::Asset::ID id)
+{
+    return getPresentation(id).smallestUnitName;
+}
+
+QColor AssetsManager::getColor(beam::Asset::ID id)
+{
+    return getPresentation(id).color;
+}
+
 beam::Amount AssetsManager::getRate(beam::Asset::ID assetId)
 {
     beam::wallet::Currency assetCurr(assetId);
@@ -437,10 +646,15 @@ void AssetsManager::onAssetVerification(const std::vector<beam::wallet::Verifica
 {
     for (const auto& info: changed)
     {
+        auto it = m_vi.find(info.m_assetID);
+        if (it != m_vi.end() && isSameVerification(it->second, info))
+        {
+            continue;
+        }
+
         m_vi[info.m_assetID] = info;
-        emit assetInfo(info.m_assetID);
+        notifyAssetInfo(info.m_assetID);
     }
-    emit assetsListChanged();
 }
 
 bool AssetsManager::isVerified(beam::Asset::ID assetId) const
@@ -18,8 +18,12 @@
 #include <QMap>
 #include <QList>
 #include <QVariant>
+#include <QSet>
+#include <QTimer>
+#include <unordered_map>
 #include "wallet_model.h"
 #include "exchange_rates_manager.h"
+#include "transactions_store.h"
 
 class AssetsManager: public QObject
 {
@@ -27,7 +31,7 @@ class AssetsManager: public QObject
 public:
     typedef std::shared_ptr<AssetsManager> Ptr;
 
-    AssetsManager(WalletModel::Ptr wallet, ExchangeRatesManager::Ptr rates);
+    AssetsManager(WalletModel::Ptr wallet, ExchangeRatesManager::Ptr rates, const TransactionsStore& transactions);
     ~AssetsManager() override = default;
 
     // SYNC
@@ -55,22 +59,53 @@ public:
     [[nodiscard]] bool hasAsset(beam::Asset::ID) const;
     [[nodiscard]] bool isVerified(beam::Asset::ID) const;
 
+    // Ready to show values of an asset, built on the first request and rebuilt after the asset info changes
+    struct Presentation
+    {
+        QString  icon;
+        QColor   color;
+        QString  name;
+        QString  unitName;
+        QString  unitNameShortTxt;
+        QString  unitNameShortHtml;
+        QString  smallestUnitName;
+        bool     verified = false;
+    };
+
+    [[nodiscard]] const Presentation& getPresentation(beam::Asset::ID);
+
 signals:
-    void assetInfo(beam::Asset::ID assetId);
+    // Assets with new info or verification, collected over one event loop turn
+    void assetsInfoChanged(const QSet<beam::Asset::ID>& assets);
     void assetsListChanged();
 
 private slots:
     void onAssetInfo(beam::Asset::ID, const beam::wallet::WalletAsset&);
     void onAssetVerification(const std::vector<beam::wallet::VerificationInfo>&);
+    void onTransactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&);
+    void onNormalCoinsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::Coin>&);
+    #ifdef BEAM_LELANTUS_SUPPORT
+    void onShieldedCoinChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::ShieldedCoin>&);
+    #endif // BEAM_LELANTUS_SUPPORT
+    void flush();
 
 private:
     // ASYNC
     void collectAssetInfo(beam::Asset::ID);
+    void requestAssetInfo(beam::Asset::ID);
+    void revalidateAssetInfo(beam::Asset::ID);
+    void prefetchAssetInfo(beam::Asset::ID);
+    void notifyAssetInfo(beam::Asset::ID);
 
     typedef std::shared_ptr<beam::wallet::WalletAssetMeta> MetaPtr;
     typedef std::shared_ptr<beam::wallet::WalletAsset> AssetPtr;
     typedef std::pair<AssetPtr, MetaPtr> InfoPair;
     MetaPtr getAsset(beam::Asset::ID);
+    QString makeIcon(beam::Asset::ID);
+    QString makeUnitName(beam::Asset::ID, Shorten shorten);
+    QString makeName(beam::Asset::ID);
+    QString makeSmallestUnitName(beam::Asset::ID);
+    QColor  makeColor(beam::Asset::ID);
     QMap<QString, QVariant> getAssetProps(beam::Asset::ID);
 
     WalletModel::Ptr _wallet;
@@ -78,7 +113,13 @@ private:
     std::map<beam::Asset::ID, beam::wallet::VerificationInfo> m_vi;
     std::map<beam::Asset::ID, InfoPair> _info;
     std::set<beam::Asset::ID> _requested;
+    std::set<beam::Asset::ID> _pending;
+    QSet<beam::Asset::ID> _changed;
+    QTimer _flushTimer;
+    std::map<beam::Asset::ID, beam::Height> _validated;
 
     std::map<int, QColor>  _colors;
     std::map<int, QString> _icons;
+
+    std::unordered_map<beam::Asset::ID, Presentation> _presentation;
 };
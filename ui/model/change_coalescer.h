@@ -0,0 +1,140 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QElapsedTimer>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "wallet/client/wallet_client.h"
+#include "viewmodel/helpers/list_model.h"
+
+//
+// Collects wallet deltas on the UI thread and merges them per key until the next flush.
+// Reset is never delayed: it makes everything collected before it obsolete and goes out at once.
+// Flush emits at most one batch per action for each chunk and stops when the frame budget is spent
+//
+template <typename T, typename Key>
+class ChangeCoalescer
+{
+public:
+    using KeyOf = std::function<Key(const T&)>;
+    using Emitter = std::function<void(beam::wallet::ChangeAction, const std::vector<T>&)>;
+
+    ChangeCoalescer(KeyOf keyOf, Emitter emitter)
+        : m_keyOf(std::move(keyOf))
+        , m_emit(std::move(emitter))
+    {
+    }
+
+    // Returns true if there is something left for the next flush
+    bool push(beam::wallet::ChangeAction action, const std::vector<T>& items)
+    {
+        using beam::wallet::ChangeAction;
+
+        if (action == ChangeAction::Reset)
+        {
+            clear();
+            m_emit(action, items);
+            return false;
+        }
+
+        for (const auto& item : items)
+        {
+            auto [it, inserted] = m_index.try_emplace(m_keyOf(item), m_pending.size());
+            if (inserted)
+            {
+                m_pending.push_back({item, action});
+                continue;
+            }
+
+            auto& entry = m_pending[it->second];
+            entry.item = item;
+            entry.action = merge(entry.action, action);
+        }
+        return !empty();
+    }
+
+    // Emits pending changes until the budget is used, returns true if something is left
+    bool flush(const QElapsedTimer& frame, qint64 budgetMs)
+    {
+        using beam::wallet::ChangeAction;
+
+        while (!empty() && frame.elapsed() < budgetMs)
+        {
+            const size_t last = std::min(m_next + kChunkSize, m_pending.size());
+            std::vector<T> removed, added, updated;
+            for (; m_next < last; ++m_next)
+            {
+                auto& entry = m_pending[m_next];
+                m_index.erase(m_keyOf(entry.item));
+                switch (entry.action)
+                {
+                case ChangeAction::Removed: removed.push_back(std::move(entry.item)); break;
+                case ChangeAction::Added: added.push_back(std::move(entry.item)); break;
+                default: updated.push_back(std::move(entry.item)); break;
+                }
+            }
+
+            if (empty())
+            {
+                clear();
+            }
+
+            if (!removed.empty()) m_emit(ChangeAction::Removed, removed);
+            if (!added.empty()) m_emit(ChangeAction::Added, added);
+            if (!updated.empty()) m_emit(ChangeAction::Updated, updated);
+        }
+        return !empty();
+    }
+
+    bool empty() const
+    {
+        return m_next >= m_pending.size();
+    }
+
+private:
+    static constexpr size_t kChunkSize = 256;
+
+    struct Entry
+    {
+        T item;
+        beam::wallet::ChangeAction action;
+    };
+
+    static beam::wallet::ChangeAction merge(beam::wallet::ChangeAction prev, beam::wallet::ChangeAction next)
+    {
+        using beam::wallet::ChangeAction;
+
+        // receivers have not seen the item yet, it stays new whatever happens to it later
+        if (prev == ChangeAction::Added && next == ChangeAction::Updated)
+        {
+            return ChangeAction::Added;
+        }
+        return next;
+    }
+
+    void clear()
+    {
+        m_pending.clear();
+        m_index.clear();
+        m_next = 0;
+    }
+
+    KeyOf m_keyOf;
+    Emitter m_emit;
+    std::vector<Entry> m_pending;
+    std::unordered_map<Key, size_t, ListModelKeyHash> m_index;
+    size_t m_next = 0;
+};
@@ -0,0 +1,230 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "transactions_store.h"
+
+TransactionsStore::TransactionsStore(WalletModel::Ptr wallet)
+    : _wallet(std::move(wallet))
+{
+    connect(_wallet.get(), &WalletModel::transactionsChanged, this, &TransactionsStore::onTransactionsChanged);
+}
+
+void TransactionsStore::load()
+{
+    if (_requested)
+    {
+        return;
+    }
+
+    _requested = true;
+    _wallet->getAsync()->getTransactions();
+}
+
+bool TransactionsStore::isLoaded() const
+{
+    return _loaded;
+}
+
+const std::vector<beam::wallet::TxDescription>& TransactionsStore::getTransactions() const
+{
+    return _transactions;
+}
+
+const beam::wallet::TxDescription* TransactionsStore::getTransaction(const beam::wallet::TxID& txId) const
+{
+    auto it = _index.find(txId);
+    return it != _index.end() ? &_transactions[it->second] : nullptr;
+}
+
+bool TransactionsStore::contains(const beam::wallet::TxID& txId) const
+{
+    return _index.find(txId) != _index.end();
+}
+
+bool TransactionsStore::isBusyAddress(const beam::wallet::WalletID& walletID) const
+{
+    return _busyAddresses.find(walletID) != _busyAddresses.end();
+}
+
+bool TransactionsStore::hasContractNotification(const beam::wallet::TxID& txId) const
+{
+    return _contractNotifications.find(txId) != _contractNotifications.end();
+}
+
+bool TransactionsStore::needsContractNotification(const beam::wallet::TxDescription& tx)
+{
+    using namespace beam::wallet;
+
+    if (tx.m_txType != TxType::Contract)
+    {
+        return false;
+    }
+
+    const bool active = tx.m_status == TxStatus::Pending ||
+                        tx.m_status == TxStatus::InProgress ||
+                        tx.m_status == TxStatus::Registering ||
+                        tx.m_status == TxStatus::Confirming;
+    if (!active)
+    {
+        return false;
+    }
+
+    bool isMarkedAsRead = false;
+    tx.GetParameter(TxParameterID::IsContractNotificationMarkedAsRead, isMarkedAsRead);
+    return !isMarkedAsRead;
+}
+
+void TransactionsStore::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+{
+    using namespace beam::wallet;
+
+    switch (action)
+    {
+        case ChangeAction::Reset:
+            {
+                _transactions.clear();
+                _index.clear();
+                _busyAddresses.clear();
+                _transactions.reserve(items.size());
+                _index.reserve(items.size());
+                for (const auto& tx : items)
+                {
+                    upsert(tx);
+                }
+                _requested = true;
+                _loaded = true;
+
+                // notifications already shown stay shown, only the vanished transactions are dropped
+                for (auto it = _contractNotifications.begin(); it != _contractNotifications.end();)
+                {
+                    it = contains(*it) ? std::next(it) : _contractNotifications.erase(it);
+                }
+
+                // subscribers get the deduplicated state, not the raw wallet vector
+                emit transactionsChanged(action, _transactions);
+                emitContractNotifications();
+                return;
+            }
+
+        case ChangeAction::Added:
+        case ChangeAction::Updated:
+            {
+                for (const auto& tx : items)
+                {
+                    upsert(tx);
+                }
+                break;
+            }
+
+        case ChangeAction::Removed:
+            {
+                for (const auto& tx : items)
+                {
+                    erase(tx.m_txId);
+                }
+                break;
+            }
+
+        default:
+            assert(false && "Unexpected action");
+            break;
+    }
+
+    emit transactionsChanged(action, items);
+    emitContractNotifications();
+}
+
+void TransactionsStore::upsert(const beam::wallet::TxDescription& tx)
+{
+    if (auto it = _index.find(tx.m_txId); it != _index.end())
+    {
+        auto& stored = _transactions[it->second];
+        countBusy(stored, false);
+        stored = tx;
+    }
+    else
+    {
+        _index.emplace(tx.m_txId, _transactions.size());
+        _transactions.push_back(tx);
+    }
+    countBusy(tx, true);
+    indexContractNotification(tx);
+}
+
+void TransactionsStore::erase(const beam::wallet::TxID& txId)
+{
+    auto it = _index.find(txId);
+    if (it == _index.end())
+    {
+        return;
+    }
+
+    const auto pos = it->second;
+    countBusy(_transactions[pos], false);
+    _contractNotifications.erase(txId);
+    _index.erase(it);
+
+    // order is not kept, the last one takes the freed slot
+    if (pos + 1 != _transactions.size())
+    {
+        _transactions[pos] = std::move(_transactions.back());
+        _index[_transactions[pos].m_txId] = pos;
+    }
+    _transactions.pop_back();
+}
+
+void TransactionsStore::countBusy(const beam::wallet::TxDescription& tx, bool add)
+{
+    if (tx.canDelete())
+    {
+        return;
+    }
+
+    if (add)
+    {
+        ++_busyAddresses[tx.m_myId];
+        return;
+    }
+
+    auto it = _busyAddresses.find(tx.m_myId);
+    if (it != _busyAddresses.end() && --it->second == 0)
+    {
+        _busyAddresses.erase(it);
+    }
+}
+
+void TransactionsStore::indexContractNotification(const beam::wallet::TxDescription& tx)
+{
+    if (!needsContractNotification(tx))
+    {
+        _contractNotifications.erase(tx.m_txId);
+        return;
+    }
+
+    if (_contractNotifications.insert(tx.m_txId).second)
+    {
+        _addedNotifications.push_back(tx.m_txId);
+    }
+}
+
+void TransactionsStore::emitContractNotifications()
+{
+    if (_addedNotifications.empty())
+    {
+        return;
+    }
+
+    std::vector<beam::wallet::TxID> added;
+    added.swap(_addedNotifications);
+    emit contractNotificationsAdded(added);
+}
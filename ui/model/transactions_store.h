@@ -0,0 +1,77 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "wallet_model.h"
+#include "viewmodel/helpers/list_model.h"
+
+//
+// The only subscriber of WalletModel transactions. Requests the history once,
+// keeps it up to date and serves it to the view models together with derived indexes.
+// View models connect to transactionsChanged and take the current state with getTransactions()
+//
+class TransactionsStore: public QObject
+{
+    Q_OBJECT
+public:
+    typedef std::shared_ptr<TransactionsStore> Ptr;
+
+    explicit TransactionsStore(WalletModel::Ptr wallet);
+    ~TransactionsStore() override = default;
+
+    // Asks the wallet for the history, only the first call goes to the DB
+    void load();
+    [[nodiscard]] bool isLoaded() const;
+
+    [[nodiscard]] const std::vector<beam::wallet::TxDescription>& getTransactions() const;
+    [[nodiscard]] const beam::wallet::TxDescription* getTransaction(const beam::wallet::TxID& txId) const;
+    [[nodiscard]] bool contains(const beam::wallet::TxID& txId) const;
+
+    // Own address used by a transaction which cannot be deleted yet
+    [[nodiscard]] bool isBusyAddress(const beam::wallet::WalletID& walletID) const;
+
+    // Active contract transaction whose notification is not marked as read yet
+    [[nodiscard]] bool hasContractNotification(const beam::wallet::TxID& txId) const;
+    [[nodiscard]] static bool needsContractNotification(const beam::wallet::TxDescription& tx);
+
+signals:
+    // Wallet deltas, emitted after the store has applied them
+    void transactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+    // Transactions that started to need a contract notification with the last delta, emitted after transactionsChanged
+    void contractNotificationsAdded(const std::vector<beam::wallet::TxID>& txIds);
+
+private slots:
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+
+private:
+    void upsert(const beam::wallet::TxDescription& tx);
+    void erase(const beam::wallet::TxID& txId);
+    void countBusy(const beam::wallet::TxDescription& tx, bool add);
+    void indexContractNotification(const beam::wallet::TxDescription& tx);
+    void emitContractNotifications();
+
+    WalletModel::Ptr _wallet;
+    std::vector<beam::wallet::TxDescription> _transactions;
+    std::unordered_map<beam::wallet::TxID, size_t, ListModelKeyHash> _index;
+    std::map<beam::wallet::WalletID, size_t> _busyAddresses;
+    std::unordered_set<beam::wallet::TxID, ListModelKeyHash> _contractNotifications;
+    std::vector<beam::wallet::TxID> _addedNotifications;   // collected while a delta is applied
+    bool _requested = false;
+    bool _loaded = false;
+};
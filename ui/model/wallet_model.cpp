@@ -24,9 +24,46 @@ using namespace beam;
 using namespace beam::io;
 using namespace std;
 
+namespace
+{
+    // one frame to collect deltas, and how much of the next frame may be spent applying them
+    const int kChangesFlushIntervalMs = 16;
+    const qint64 kChangesFlushBudgetMs = 8;
+
+    ECC::Hash::Value getCoinKey(const beam::wallet::Coin& coin)
+    {
+        ECC::Hash::Value hv;
+        coin.m_ID.get_Hash(hv);
+        return hv;
+    }
+
+    ECC::Hash::Value getShieldedCoinKey(const beam::wallet::ShieldedCoin& coin)
+    {
+        ECC::Hash::Processor hp;
+        hp << coin.m_TxoID
+           << coin.m_CoinID.m_Value
+           << coin.m_CoinID.m_AssetID;
+        ECC::Hash::Value hv;
+        hp >> hv;
+        return hv;
+    }
+}
 
 WalletModel::WalletModel(beam::wallet::IWalletDB::Ptr walletDB, const std::string& nodeAddr, beam::io::Reactor::Ptr reactor)
     : WalletClient(Rules::get(), walletDB,  nodeAddr, reactor)
+    , m_txChanges([](const auto& tx) { return tx.m_txId; },
+                  [this](auto action, const auto& items) { emit transactionsChanged(action, items); })
+    , m_coinChanges(getCoinKey,
+                    [this](auto action, const auto& items) { emit normalCoinsChanged(action, items); })
+    , m_shieldedCoinChanges(getShieldedCoinKey,
+                            [this](auto action, const auto& items)
+                            {
+#ifdef BEAM_LELANTUS_SUPPORT
+                                emit shieldedCoinChanged(action, items);
+#endif
+                            })
+    , m_notificationChanges([](const auto& notification) { return notification.m_ID; },
+                            [this](auto action, const auto& items) { emit notificationsChanged(action, items); })
 {
     qRegisterMetaType<beam::ByteBuffer>("beam::ByteBuffer");
     qRegisterMetaType<beam::wallet::WalletStatus>("beam::wallet::WalletStatus");
@@ -50,8 +87,22 @@ WalletModel::WalletModel(beam::wallet::IWalletDB::Ptr walletDB, const std::strin
     qRegisterMetaType<boost::optional<beam::wallet::WalletAddress>>("boost::optional<beam::wallet::WalletAddress>");
     qRegisterMetaType<beam::wallet::CoinsSelectionInfo>("beam::wallet::CoinsSelectionInfo");
     qRegisterMetaType<vector<beam::wallet::DexOrder>>("std::vector<beam::wallet::DexOrder>");
+    qRegisterMetaType<SharedChanges<beam::wallet::TxDescription>>("SharedChanges<beam::wallet::TxDescription>");
+    qRegisterMetaType<SharedChanges<beam::wallet::Coin>>("SharedChanges<beam::wallet::Coin>");
+    qRegisterMetaType<SharedChanges<beam::wallet::ShieldedCoin>>("SharedChanges<beam::wallet::ShieldedCoin>");
+    qRegisterMetaType<SharedChanges<beam::wallet::WalletAddress>>("SharedChanges<beam::wallet::WalletAddress>");
+    qRegisterMetaType<SharedChanges<beam::wallet::Notification>>("SharedChanges<beam::wallet::Notification>");
 
     connect(this, &WalletModel::walletStatusInternal, this, &WalletModel::onWalletStatusInternal);
+    connect(this, &WalletModel::transactionsChangedInternal, this, &WalletModel::onTransactionsChangedInternal);
+    connect(this, &WalletModel::normalCoinsChangedInternal, this, &WalletModel::onNormalCoinsChangedInternal);
+    connect(this, &WalletModel::shieldedCoinChangedInternal, this, &WalletModel::onShieldedCoinChangedInternal);
+    connect(this, &WalletModel::addressesChangedInternal, this, &WalletModel::onAddressesChangedInternal);
+    connect(this, &WalletModel::notificationsChangedInternal, this, &WalletModel::onNotificationsChangedInternal);
+
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(kChangesFlushIntervalMs);
+    connect(&m_flushTimer, &QTimer::timeout, this, &WalletModel::flushChanges);
     connect(this, SIGNAL(addressesChanged(bool, const std::vector<beam::wallet::WalletAddress>&)),this, SLOT(setAddresses(bool, const std::vector<beam::wallet::WalletAddress>&)));
     connect(this, SIGNAL(functionPosted(const std::function<void()>&)), this, SLOT(doFunction(const std::function<void()>&)));
 
@@ -125,7 +176,7 @@ void WalletModel::onStatus(const beam::wallet::WalletStatus& status)
 
 void WalletModel::onTxStatus(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
 {
-    emit transactionsChanged(action, items);
+    emit transactionsChangedInternal(action, std::make_shared<const std::vector<beam::wallet::TxDescription>>(items));
 }
 
 void WalletModel::onSyncProgressUpdated(int done, int total)
@@ -145,19 +196,19 @@ void WalletModel::onCoinsSelected(const beam::wallet::CoinsSelectionInfo& select
 
 void WalletModel::onNormalCoinsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::Coin>& utxos)
 {
-    emit normalCoinsChanged(action, utxos);
+    emit normalCoinsChangedInternal(action, std::make_shared<const std::vector<beam::wallet::Coin>>(utxos));
 }
 
 void WalletModel::onShieldedCoinChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::ShieldedCoin>& items)
 {
 #ifdef BEAM_LELANTUS_SUPPORT
-    emit shieldedCoinChanged(action, items);
+    emit shieldedCoinChangedInternal(action, std::make_shared<const std::vector<beam::wallet::ShieldedCoin>>(items));
 #endif
 }
 
 void WalletModel::onAddressesChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::WalletAddress>& items)
 {
-    emit addressesChanged(action, items);
+    emit addressesChangedInternal(action, std::make_shared<const std::vector<beam::wallet::WalletAddress>>(items));
     for (const auto& item : items)
     {
         if (item.isOwn())
@@ -319,7 +370,7 @@ void WalletModel::onVerificationInfo(const std::vector<beam::wallet::Verificatio
 
 void WalletModel::onNotificationsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::Notification>& notifications)
 {
-    emit notificationsChanged(action, notifications);
+    emit notificationsChangedInternal(action, std::make_shared<const std::vector<beam::wallet::Notification>>(notifications));
 }
 
 void WalletModel::onPublicAddress(const std::string& publicAddr)
@@ -345,7 +396,73 @@ uint32_t WalletModel::getClientRevision() const
 
 void WalletModel::onWalletStatusInternal(const beam::wallet::WalletStatus& newStatus)
 {
-    emit walletStatusChanged();
+    // the getters are up to date here, read them once for everybody
+    WalletStatusSnapshot::Balances balances;
+    for (auto aid : getAssetsNZ())
+    {
+        auto& balance = balances[aid];
+        balance.available = getAvailable(aid);
+        balance.availableRegular = getAvailableRegular(aid);
+        balance.availableShielded = getAvailableShielded(aid);
+        balance.maturing = getMaturing(aid);
+        balance.maturingMP = getMatutingMP(aid);
+        balance.receivingChange = getReceivingChange(aid);
+    }
+
+    m_statusSnapshot = std::make_shared<const WalletStatusSnapshot>(m_statusSnapshot, getCurrentHeight(), std::move(balances));
+    emit walletStatusChanged(m_statusSnapshot);
+}
+
+WalletStatusSnapshot::Ptr WalletModel::getStatusSnapshot() const
+{
+    return m_statusSnapshot;
+}
+
+void WalletModel::onTransactionsChangedInternal(beam::wallet::ChangeAction action, const SharedChanges<beam::wallet::TxDescription>& items)
+{
+    scheduleFlush(m_txChanges.push(action, *items));
+}
+
+void WalletModel::onNormalCoinsChangedInternal(beam::wallet::ChangeAction action, const SharedChanges<beam::wallet::Coin>& utxos)
+{
+    scheduleFlush(m_coinChanges.push(action, *utxos));
+}
+
+void WalletModel::onShieldedCoinChangedInternal(beam::wallet::ChangeAction action, const SharedChanges<beam::wallet::ShieldedCoin>& coins)
+{
+    scheduleFlush(m_shieldedCoinChanges.push(action, *coins));
+}
+
+void WalletModel::onAddressesChangedInternal(beam::wallet::ChangeAction action, const SharedChanges<beam::wallet::WalletAddress>& addresses)
+{
+    emit addressesChanged(action, *addresses);
+}
+
+void WalletModel::onNotificationsChangedInternal(beam::wallet::ChangeAction action, const SharedChanges<beam::wallet::Notification>& notifications)
+{
+    scheduleFlush(m_notificationChanges.push(action, *notifications));
+}
+
+void WalletModel::scheduleFlush(bool pending)
+{
+    if (pending && !m_flushTimer.isActive())
+    {
+        m_flushTimer.start();
+    }
+}
+
+void WalletModel::flushChanges()
+{
+    QElapsedTimer frame;
+    frame.start();
+
+    bool pending = m_txChanges.flush(frame, kChangesFlushBudgetMs);
+    pending = m_coinChanges.flush(frame, kChangesFlushBudgetMs) || pending;
+    pending = m_shieldedCoinChanges.flush(frame, kChangesFlushBudgetMs) || pending;
+    pending = m_notificationChanges.flush(frame, kChangesFlushBudgetMs) || pending;
+
+    // the rest goes in the next frame, the window gets a chance to repaint and handle input
+    scheduleFlush(pending);
 }
 
 void WalletModel::setAddresses(bool own, const std::vector<beam::wallet::WalletAddress>& addrs)
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QObject>
+#include <QTimer>
 
 #include "wallet/client/wallet_client.h"
 
@@ -23,6 +24,21 @@
 #endif
 
 #include <set>
+#include <memory>
+#include <vector>
+#include "change_coalescer.h"
+#include "wallet_status_snapshot.h"
+
+// Immutable change set built once on the reactor thread. Queued connections copy
+// only the pointer, every UI receiver reads the same vector
+template <typename T>
+using SharedChanges = std::shared_ptr<const std::vector<T>>;
+
+Q_DECLARE_METATYPE(SharedChanges<beam::wallet::TxDescription>)
+Q_DECLARE_METATYPE(SharedChanges<beam::wallet::Coin>)
+Q_DECLARE_METATYPE(SharedChanges<beam::wallet::ShieldedCoin>)
+Q_DECLARE_METATYPE(SharedChanges<beam::wallet::WalletAddress>)
+Q_DECLARE_METATYPE(SharedChanges<beam::wallet::Notification>)
 
 class WalletModel
     : public QObject
@@ -41,6 +57,9 @@ public:
     bool isOwnAddress(const beam::wallet::WalletID& walletID) const;
     bool isAddressWithCommentExist(const std::string& comment) const;
 
+    // Latest published balances, null until the first status arrives
+    [[nodiscard]] WalletStatusSnapshot::Ptr getStatusSnapshot() const;
+
 signals:
     // INTERNAL SIGNALS, DO NOT SUBSCRIBE IN OTHER UI OBJECTS.
     // Subscribe to non-internal counterparts
@@ -48,13 +67,19 @@ signals:
     // and cache some data. Due to old designed getters (getAvailable &c.).
     // Better to avoid such internal signals
     void walletStatusInternal(const beam::wallet::WalletStatus& status);
+    void transactionsChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::TxDescription>& items);
+    void normalCoinsChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::Coin>& utxos);
+    void shieldedCoinChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::ShieldedCoin>& coins);
+    void addressesChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::WalletAddress>& addresses);
+    void notificationsChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::Notification>& notifications);
 
     // Public Signal
-    void walletStatusChanged();
+    void walletStatusChanged(const WalletStatusSnapshot::Ptr& status);
     void assetInfoChanged(beam::Asset::ID assetId, const beam::wallet::WalletAsset& info);
     void iwtCallResult(const QString& callId, boost::any);
 
 signals:
+    // Change sets below are re-emitted on the UI thread from the shared snapshot, receivers are called directly
     void transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>& items);
     void syncProgressUpdated(int done, int total);
     void changeCalculated(beam::Amount changeAsset, beam::Amount changeBeam, beam::Asset::ID);
@@ -150,10 +175,26 @@ private:
 
 private slots:
     void onWalletStatusInternal(const beam::wallet::WalletStatus& status);
+    void onTransactionsChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::TxDescription>& items);
+    void onNormalCoinsChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::Coin>& utxos);
+    void onShieldedCoinChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::ShieldedCoin>& coins);
+    void onAddressesChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::WalletAddress>& addresses);
+    void onNotificationsChangedInternal(beam::wallet::ChangeAction, const SharedChanges<beam::wallet::Notification>& notifications);
     void setAddresses(bool own, const std::vector<beam::wallet::WalletAddress>& addrs);
     void doFunction(const std::function<void()>& func);
+    void flushChanges();
 
 private:
+    void scheduleFlush(bool pending);
+
+    // sync delivers lots of tiny batches, they are merged and applied once per frame
+    QTimer m_flushTimer;
+    ChangeCoalescer<beam::wallet::TxDescription, beam::wallet::TxID> m_txChanges;
+    ChangeCoalescer<beam::wallet::Coin, ECC::Hash::Value> m_coinChanges;
+    ChangeCoalescer<beam::wallet::ShieldedCoin, ECC::Hash::Value> m_shieldedCoinChanges;
+    ChangeCoalescer<beam::wallet::Notification, ECC::uintBig> m_notificationChanges;
+
+    WalletStatusSnapshot::Ptr m_statusSnapshot;
     std::set<beam::wallet::WalletID> m_myWalletIds;
     std::set<std::string> m_myAddrLabels;
 };
@@ -0,0 +1,100 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "wallet_status_snapshot.h"
+
+WalletStatusSnapshot::WalletStatusSnapshot(const Ptr& prev, beam::Height height, Balances balances)
+    : m_version(prev ? prev->m_version + 1 : 1)
+    , m_height(height)
+    , m_heightChanged(!prev || prev->m_height != height)
+    , m_balances(std::move(balances))
+{
+    static const Balances kEmpty;
+    const auto& prevBalances = prev ? prev->m_balances : kEmpty;
+
+    // both maps are ordered, walk them side by side
+    auto p = prevBalances.begin();
+    auto n = m_balances.begin();
+    while (p != prevBalances.end() || n != m_balances.end())
+    {
+        if (n == m_balances.end() || (p != prevBalances.end() && p->first < n->first))
+        {
+            m_changes.emplace_hint(m_changes.end(), p->first, AllFields);
+            ++p;
+        }
+        else if (p == prevBalances.end() || n->first < p->first)
+        {
+            m_changes.emplace_hint(m_changes.end(), n->first, AllFields);
+            ++n;
+        }
+        else
+        {
+            if (const auto fields = diff(p->second, n->second); fields)
+            {
+                m_changes.emplace_hint(m_changes.end(), n->first, fields);
+            }
+            ++p;
+            ++n;
+        }
+    }
+}
+
+uint64_t WalletStatusSnapshot::getVersion() const
+{
+    return m_version;
+}
+
+beam::Height WalletStatusSnapshot::getHeight() const
+{
+    return m_height;
+}
+
+bool WalletStatusSnapshot::isHeightChanged() const
+{
+    return m_heightChanged;
+}
+
+const WalletStatusSnapshot::Balances& WalletStatusSnapshot::getBalances() const
+{
+    return m_balances;
+}
+
+const WalletStatusSnapshot::Balance& WalletStatusSnapshot::getBalance(beam::Asset::ID id) const
+{
+    static const Balance kZero;
+    auto it = m_balances.find(id);
+    return it != m_balances.end() ? it->second : kZero;
+}
+
+const WalletStatusSnapshot::Changes& WalletStatusSnapshot::getChanges() const
+{
+    return m_changes;
+}
+
+uint8_t WalletStatusSnapshot::getChangedFields(beam::Asset::ID id) const
+{
+    auto it = m_changes.find(id);
+    return it != m_changes.end() ? it->second : 0;
+}
+
+uint8_t WalletStatusSnapshot::diff(const Balance& prev, const Balance& next)
+{
+    uint8_t fields = 0;
+    if (prev.available != next.available)                 fields |= Available;
+    if (prev.availableRegular != next.availableRegular)   fields |= AvailableRegular;
+    if (prev.availableShielded != next.availableShielded) fields |= AvailableShielded;
+    if (prev.maturing != next.maturing)                   fields |= Maturing;
+    if (prev.maturingMP != next.maturingMP)               fields |= MaturingMP;
+    if (prev.receivingChange != next.receivingChange)     fields |= ReceivingChange;
+    return fields;
+}
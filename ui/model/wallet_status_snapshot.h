@@ -0,0 +1,80 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <map>
+#include <memory>
+#include <QMetaType>
+#include "core/block_crypt.h"
+
+//
+// Balances of the wallet at one status update. Published once per update and never modified,
+// every receiver reads the same instance. Each version carries the fields that moved since
+// the previous one per asset, so receivers repaint only what did change
+//
+class WalletStatusSnapshot
+{
+public:
+    using Ptr = std::shared_ptr<const WalletStatusSnapshot>;
+
+    enum Field : uint8_t
+    {
+        Available         = 1 << 0,
+        AvailableRegular  = 1 << 1,
+        AvailableShielded = 1 << 2,
+        Maturing          = 1 << 3,
+        MaturingMP        = 1 << 4,
+        ReceivingChange   = 1 << 5,
+        AllFields         = (1 << 6) - 1,
+    };
+
+    struct Balance
+    {
+        beam::AmountBig::Type available = beam::Zero;
+        beam::AmountBig::Type availableRegular = beam::Zero;
+        beam::AmountBig::Type availableShielded = beam::Zero;
+        beam::AmountBig::Type maturing = beam::Zero;
+        beam::AmountBig::Type maturingMP = beam::Zero;
+        beam::AmountBig::Type receivingChange = beam::Zero;
+    };
+
+    using Balances = std::map<beam::Asset::ID, Balance>;
+    using Changes = std::map<beam::Asset::ID, uint8_t>;
+
+    // Diffs the balances against the previous version, assets appearing or disappearing have all fields changed
+    WalletStatusSnapshot(const Ptr& prev, beam::Height height, Balances balances);
+
+    [[nodiscard]] uint64_t getVersion() const;
+    [[nodiscard]] beam::Height getHeight() const;
+    [[nodiscard]] bool isHeightChanged() const;
+
+    // Assets with non zero balances
+    [[nodiscard]] const Balances& getBalances() const;
+    // Zero balance for unknown assets
+    [[nodiscard]] const Balance& getBalance(beam::Asset::ID id) const;
+
+    [[nodiscard]] const Changes& getChanges() const;
+    [[nodiscard]] uint8_t getChangedFields(beam::Asset::ID id) const;
+
+private:
+    static uint8_t diff(const Balance& prev, const Balance& next);
+
+    uint64_t m_version = 0;
+    beam::Height m_height = 0;
+    bool m_heightChanged = false;
+    Balances m_balances;
+    Changes m_changes;
+};
+
+Q_DECLARE_METATYPE(WalletStatusSnapshot::Ptr)
@@ -14,11 +14,14 @@ Control {
 
     TxTableViewModel {
         id: tableViewModel
+        searchFilter: searchBox.text
+        assetFilter:  control.selectedAssets
+        dappFilter:   control.dappFilter ? control.dappFilter : ""
     }
 
     property var       selectedAssets: []
     property int       emptyMessageMargin: 90
-    property int       activeTxCnt: 0
+    readonly property int activeTxCnt: tableViewModel.activeCount
     property alias     headerShaderVisible: transactionsTable.headerShaderVisible
     property var       dappFilter: undefined
     readonly property  bool sourceVisible: dappFilter ? dappFilter == "all" : true
@@ -43,8 +46,7 @@ Control {
         State {
             name: "inProgress"
             PropertyChanges { target: inProgressTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isInProgress" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: tableViewModel; kindFilter: TxTableViewModel.InProgressKind }
             PropertyChanges { target: emptyMessage;  
                 //% "There are no in progress transactions yet."
                 text: qsTrId("tx-in-progress-empty")
@@ -53,8 +55,7 @@ Control {
         State {
             name: "sent"
             PropertyChanges { target: sentTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isSent" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: tableViewModel; kindFilter: TxTableViewModel.SentKind }
             PropertyChanges { target: emptyMessage;  
                 //% "There are no sent transactions yet."
                 text: qsTrId("tx-sent-empty")
@@ -63,8 +64,7 @@ Control {
         State {
             name: "received"
             PropertyChanges { target: receivedTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isReceived" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: tableViewModel; kindFilter: TxTableViewModel.ReceivedKind }
             PropertyChanges { target: emptyMessage;  
                 //% "There are no received transactions yet."
                 text: qsTrId("tx-received-empty")
@@ -218,6 +218,8 @@ Control {
                Layout.alignment: Qt.AlignVCenter
                //% "Enter search text..."
                placeholderText: qsTrId("wallet-search-transactions-placeholder")
+               // search runs over the loaded rows only, bring in the rest of the history
+               onTextChanged: if (text.length) tableViewModel.loadAllTransactions()
             }
 
             CustomToolButton {
@@ -338,11 +340,13 @@ Control {
 
                 var index = tableViewModel.transactions.index(0, 0);
                 var indexList = tableViewModel.transactions.match(index, TxObjectList.Roles.TxID, id);
+                if (indexList.length == 0) {
+                    tableViewModel.loadAllTransactions();
+                    index = tableViewModel.transactions.index(0, 0);
+                    indexList = tableViewModel.transactions.match(index, TxObjectList.Roles.TxID, id);
+                }
                 if (indexList.length > 0) {
-                    index = dappFilterProxy.mapFromSource(indexList[0]);
-                    index = assetFilterProxy.mapFromSource(index);
-                    index = searchProxyModel.mapFromSource(index);
-                    index = txProxyModel.mapFromSource(index);
+                    index = txProxyModel.mapFromSource(indexList[0]);
                     transactionsTable.positionViewAtRow(index.row, ListView.Beginning);
 
                     initTxDetailsFromRow(transactionsTable.model, index.row);
@@ -351,16 +355,6 @@ Control {
             }
 
             Component.onCompleted: function () {
-                txProxyModel.source.countChanged.connect(function() {
-                    control.activeTxCnt = 0
-                    var source = txProxyModel.source
-                    for (var idx = 0; idx < source.count; ++idx) {
-                        var qindex = source.index(idx, 0);
-                        if (source.data(qindex, TxObjectList.Roles.IsActive)) {
-                            ++control.activeTxCnt
-                        }
-                    }
-                })
                 transactionsTable.model.modelReset.connect(function() {
                     var activeTxId = "";
                     if (owner && owner != undefined && owner.openedTxID != undefined && owner.openedTxID != "") {
@@ -390,39 +384,25 @@ Control {
                 sortIndicatorOrder = sortIndicatorColumn != 1
                     ? Qt.AscendingOrder
                     : Qt.DescendingOrder;
+                loadAllIfReordered();
+            }
+
+            onSortIndicatorOrderChanged: loadAllIfReordered()
+
+            // the history is paged newest first, any other order needs all of it
+            function loadAllIfReordered() {
+                if (getColumn(sortIndicatorColumn).role != "timeCreated" || sortIndicatorOrder != Qt.DescendingOrder)
+                    tableViewModel.loadAllTransactions();
             }
 
             model: SortFilterProxyModel {
                 id: txProxyModel
 
-                source: SortFilterProxyModel {
-                    id: searchProxyModel
-                    filterRole: "search"
-                    filterString: searchBox.text
-                    filterSyntax: SortFilterProxyModel.Wildcard
-                    filterCaseSensitivity: Qt.CaseInsensitive
-
-                    source: SortFilterProxyModel {
-                        id:           assetFilterProxy
-                        filterRole:   "assetFilter"
-                        filterString: control.selectedAssets.reduce(function(sum, current) { return sum + ["|", "\\b", current, "\\b"].join(""); }, "").slice(1)
-                        filterSyntax: SortFilterProxyModel.RegExp
-
-                        source: SortFilterProxyModel {
-                            id:           dappFilterProxy
-                            filterRole:   dappFilter ? (dappFilter == "all" ? "isDappTx" : "dappId") : ""
-                            filterString: dappFilter ? (dappFilter == "all" ? "true" : dappFilter) : ""
-                            filterSyntax: SortFilterProxyModel.FixedString
-                            filterCaseSensitivity: Qt.CaseInsensitive
-                            source: tableViewModel.transactions
-                        }
-                    }
-                }
+                source: tableViewModel.transactions
 
                 sortOrder: transactionsTable.sortIndicatorOrder
                 sortCaseSensitivity: Qt.CaseInsensitive
                 sortRole: transactionsTable.getColumn(transactionsTable.sortIndicatorColumn).role + "Sort"
-                filterSyntax: SortFilterProxyModel.Wildcard
             }
 
             rowDelegate: ExpandableRowDelegate {
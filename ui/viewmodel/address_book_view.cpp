@@ -138,19 +138,17 @@ QString ContactItem::getToken() const
 
 AddressBookViewModel::AddressBookViewModel()
     : m_model(AppModel::getInstance().getWalletModel())
+    , m_transactions(AppModel::getInstance().getTransactions())
 {
     connect(m_model.get(),
             SIGNAL(addressesChanged(bool, const std::vector<beam::wallet::WalletAddress>&)),
             SLOT(onAddresses(bool, const std::vector<beam::wallet::WalletAddress>&)));
-    connect(m_model.get(),
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactions(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
     connect(m_model.get(),
             SIGNAL(addressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>&)),
             SLOT(onAddressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>&)));
 
     getAddressesFromModel();
-    m_model->getAsync()->getTransactions();
+    m_transactions->load();
     startTimer(3 * 1000);
 }
 
@@ -299,7 +297,7 @@ bool AddressBookViewModel::isWIDBusy(const QString& wid)
 {
     beam::wallet::WalletID walletID;
     walletID.FromHex(wid.toStdString());
-    return find(m_busyAddresses.cbegin(), m_busyAddresses.cend(), walletID) != m_busyAddresses.cend();
+    return m_transactions->isBusyAddress(walletID);
 }
 
 void AddressBookViewModel::deleteAddress(const QString& token)
@@ -371,62 +369,6 @@ void AddressBookViewModel::onAddressesChanged(beam::wallet::ChangeAction, const
     getAddressesFromModel();
 }
 
-void AddressBookViewModel::onTransactions(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
-{
-    using namespace beam::wallet;
-
-    switch (action)
-    {
-        case ChangeAction::Reset:
-            {
-                m_busyAddresses.clear();
-                // no beak!
-            }
-
-        case ChangeAction::Added:
-            {
-                for (const auto& tx : transactions)
-                {
-                    if (!tx.canDelete())    // only active transactions
-                    {
-                        m_busyAddresses.push_back(tx.m_myId);
-                    }
-                }
-                break;
-            }
-        
-        case ChangeAction::Updated:
-            {
-                for (const auto& tx : transactions)
-                {
-                    auto it = find(m_busyAddresses.cbegin(), m_busyAddresses.cend(), tx.m_myId);
-                    if (it != m_busyAddresses.cend() && tx.canDelete())
-                    {
-                        m_busyAddresses.erase(it);
-                    }
-                }
-                break;
-            }
-
-        case ChangeAction::Removed:
-            {
-                for (const auto& tx : transactions)
-                {
-                    auto it = find(m_busyAddresses.cbegin(), m_busyAddresses.cend(), tx.m_myId);
-                    if (it != m_busyAddresses.cend())
-                    {
-                        m_busyAddresses.erase(it);
-                    }
-                }
-                break;
-            }
-
-        default:
-            assert(false && "Unexpected action");
-            break;
-    }
-}
-
 void AddressBookViewModel::timerEvent(QTimerEvent *event)
 {
     auto firstExpired = std::remove_if(
@@ -21,6 +21,7 @@
 #include <QQmlListProperty>
 #include "wallet/core/wallet_db.h"
 #include "model/wallet_model.h"
+#include "model/transactions_store.h"
 
 class AddressItem : public QObject
 {
@@ -142,7 +143,6 @@ public:
 
 public slots:
     void onAddresses(bool own, const std::vector<beam::wallet::WalletAddress>& addresses);
-    void onTransactions(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&);
     void onAddressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>& addresses);
 
 signals:
@@ -164,6 +164,7 @@ private:
 
 private:
     WalletModel::Ptr m_model;
+    TransactionsStore::Ptr m_transactions;
     QList<ContactItem*> m_contacts;
     QList<AddressItem*> m_activeAddresses;
     QList<AddressItem*> m_expiredAddresses;
@@ -173,5 +174,4 @@ private:
     QString m_activeAddrSortRole;
     QString m_expiredAddrSortRole;
     QString m_contactSortRole;
-    std::vector<beam::wallet::WalletID> m_busyAddresses;
 };
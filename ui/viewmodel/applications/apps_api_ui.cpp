@@ -130,7 +130,7 @@ namespace beamui::applications {
             _mappedAssets.insert(assetId);
             result.push_back({
                 {"assetID", assetId},
-                {"amount", AmountToUIString(amount).toStdString()},
+                {"amount", AmountToUIStdString(amount)},
                 {"spend", spend}
             });
         }
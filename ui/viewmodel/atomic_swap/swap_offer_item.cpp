@@ -13,10 +13,10 @@
 // limitations under the License.
 
 #include "swap_offer_item.h"
+#include <cmath>
 #include "utility/helpers.h"
 #include "wallet/core/common.h"
 #include "viewmodel/ui_helpers.h"
-#include "viewmodel/qml_globals.h"
 
 
 SwapOfferItem::SwapOfferItem(QObject* parent /* = nullptr*/)
@@ -69,10 +69,21 @@ QString SwapOfferItem::rate() const
 
     if (!beamAmount) return QString();
 
-    return QMLGlobals::divideWithPrecision(
-        beamui::AmountToUIString(otherCoinAmount, getSwapCoinType(), false),
-        beamui::AmountToUIString(beamAmount), 
-        beamui::getCurrencyDecimals(getSwapCoinType()));
+    return beamui::SwapRateToUIString(otherCoinAmount, getSwapCoinType(), beamAmount);
+}
+
+double SwapOfferItem::rawRate() const
+{
+    // swap coin units per beam, the sort key of rate()
+    beam::Amount otherCoinAmount =
+        isSendBeam() ? rawAmountReceive() : rawAmountSend();
+    beam::Amount beamAmount =
+        isSendBeam() ? rawAmountSend() : rawAmountReceive();
+
+    if (!beamAmount) return 0.;
+
+    const auto scale = std::pow(10., int(beamui::getCurrencyDecimals(beamui::Currencies::Beam)) - int(beamui::getCurrencyDecimals(getSwapCoinType())));
+    return static_cast<double>(otherCoinAmount) / static_cast<double>(beamAmount) * scale;
 }
 
 QString SwapOfferItem::amountSend() const
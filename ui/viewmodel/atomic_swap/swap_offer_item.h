@@ -38,6 +38,7 @@ public:
 
     beam::Amount rawAmountSend() const;
     beam::Amount rawAmountReceive() const;
+    double rawRate() const;
 
     beam::wallet::TxParameters getTxParameters() const;
     beam::wallet::TxID getTxID() const;
@@ -71,9 +71,11 @@ QVariant SwapOffersList::data(const QModelIndex &index, int role) const
             return static_cast<qulonglong>(value->rawAmountReceive());
 
         case Roles::Rate:
-        case Roles::RateSort:
             return value->rate();
 
+        case Roles::RateSort:
+            return value->rawRate();
+
         case Roles::Expiration:
             return value->timeExpiration().toString(m_locale.dateTimeFormat(QLocale::ShortFormat));
         case Roles::ExpirationSort:
@@ -104,3 +106,8 @@ QVariant SwapOffersList::data(const QModelIndex &index, int role) const
             return QVariant();
     }
 }
+
+beam::wallet::TxID SwapOffersList::getKey(const std::shared_ptr<SwapOfferItem>& item) const
+{
+    return item->getTxID();
+}
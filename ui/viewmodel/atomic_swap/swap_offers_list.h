@@ -17,7 +17,7 @@
 #include "swap_offer_item.h"
 #include "viewmodel/helpers/list_model.h"
 #include <QLocale>
-class SwapOffersList : public ListModel<std::shared_ptr<SwapOfferItem>>
+class SwapOffersList : public ListModel<std::shared_ptr<SwapOfferItem>, beam::wallet::TxID>
 {
 
     Q_OBJECT
@@ -48,6 +48,9 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+protected:
+    beam::wallet::TxID getKey(const std::shared_ptr<SwapOfferItem>& item) const override;
+
 private:
     QLocale m_locale; // default
 };
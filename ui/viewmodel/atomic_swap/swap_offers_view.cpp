@@ -198,13 +198,12 @@ beam::Amount SwapCoinClientWrapper::getAvailable() const
 
 SwapOffersViewModel::SwapOffersViewModel()
     :   m_walletModel(AppModel::getInstance().getWalletModel())
+    ,   m_transactions(AppModel::getInstance().getTransactions())
 {
     InitSwapClientWrappers();
 
     connect(m_walletModel.get(), &WalletModel::walletStatusChanged, this, &SwapOffersViewModel::beamAvailableChanged);
-    connect(m_walletModel.get(),
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactionsDataModelChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
+    connect(m_transactions.get(), &TransactionsStore::transactionsChanged, this, &SwapOffersViewModel::onTransactionsDataModelChanged);
 
     connect(m_walletModel.get(),
             SIGNAL(swapOffersChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::SwapOffer>&)),
@@ -213,7 +212,9 @@ SwapOffersViewModel::SwapOffersViewModel()
     monitorAllOffersFitBalance();
 
     m_walletModel->getAsync()->getSwapOffers();
-    m_walletModel->getAsync()->getTransactions();
+    m_transactions->isLoaded()
+        ? onTransactionsDataModelChanged(beam::wallet::ChangeAction::Reset, m_transactions->getTransactions())
+        : m_transactions->load();
 }
 
 SwapOffersViewModel::~SwapOffersViewModel()
@@ -17,6 +17,7 @@
 #include <QObject>
 #include <QQmlListProperty>
 #include "model/wallet_model.h"
+#include "model/transactions_store.h"
 #include "model/swap_coin_client_model.h"
 #include "model/swap_eth_client_model.h"
 #include "swap_offers_list.h"
@@ -140,6 +141,7 @@ private:
     void setIsOffersLoaded(bool isOffersLoaded);
 
     WalletModel::Ptr m_walletModel;
+    TransactionsStore::Ptr m_transactions;
 
     SwapTxObjectList m_transactionsList;
     SwapOffersList m_offersList;
@@ -120,6 +120,14 @@ SwapTxObject::SwapTxObject(const beam::wallet::TxDescription& tx, uint32_t lockT
 {
 }
 
+auto SwapTxObject::getStatusStr() const -> const std::string&
+{
+    return m_statusStr.get([this]()
+    {
+        return beam::wallet::GetSwapTxStatusStr(getTxDescription());
+    });
+}
+
 bool SwapTxObject::operator==(const SwapTxObject& other) const
 {
     return getTxID() == other.getTxID();
@@ -195,8 +203,11 @@ QString SwapTxObject::getAmountWithCurrency() const
 
 QString SwapTxObject::getSentAmount() const
 {
-    QString amount = beamui::AmountToUIString(getSentAmountValue());
-    return amount == "0" ? "" : amount;
+    return m_sentAmount.get([this]()
+    {
+        QString amount = beamui::AmountToUIString(getSentAmountValue());
+        return amount == "0" ? "" : amount;
+    });
 }
 
 beam::Amount SwapTxObject::getSentAmountValue() const
@@ -220,8 +231,11 @@ QString SwapTxObject::getReceivedAmountWithCurrency() const
 
 QString SwapTxObject::getReceivedAmount() const
 {
-    QString amount = beamui::AmountToUIString(getReceivedAmountValue());
-    return amount == "0" ? "" : amount;
+    return m_receivedAmount.get([this]()
+    {
+        QString amount = beamui::AmountToUIString(getReceivedAmountValue());
+        return amount == "0" ? "" : amount;
+    });
 }
 
 beam::Amount SwapTxObject::getReceivedAmountValue() const
@@ -257,36 +271,45 @@ beam::Amount SwapTxObject::getSwapAmountValue(bool sent) const
 
 QString SwapTxObject::getFee() const
 {
-    auto fee = m_swapTx.getFee();
-    if (fee)
+    return m_fee.get([this]()
     {
-        return beamui::AmountInGrothToUIString(*fee);
-    }
-    return QString();
+        auto fee = m_swapTx.getFee();
+        if (fee)
+        {
+            return beamui::AmountInGrothToUIString(*fee);
+        }
+        return QString();
+    });
 }
 
 QString SwapTxObject::getSwapCoinFeeRate() const
 {
-    auto feeRate = m_swapTx.getSwapCoinFeeRate();
-    if (feeRate)
+    return m_swapCoinFeeRate.get([this]()
     {
-        QString value = QString::number(*feeRate);
-        QString rateMeasure = beamui::getFeeRateLabel(beamui::convertSwapCoinToCurrency(m_swapTx.getSwapCoin()));
-        return value + " " + rateMeasure;
-    }
-    return QString();
+        auto feeRate = m_swapTx.getSwapCoinFeeRate();
+        if (feeRate)
+        {
+            QString value = QString::number(*feeRate);
+            QString rateMeasure = beamui::getFeeRateLabel(beamui::convertSwapCoinToCurrency(m_swapTx.getSwapCoin()));
+            return value + " " + rateMeasure;
+        }
+        return QString();
+    });
 }
 
 QString SwapTxObject::getSwapCoinFee() const
 {
-    auto feeRate = m_swapTx.getSwapCoinFeeRate();
-    if (!feeRate)
+    return m_swapCoinFee.get([this]()
     {
-        return QString();
-    }
+        auto feeRate = m_swapTx.getSwapCoinFeeRate();
+        if (!feeRate)
+        {
+            return QString();
+        }
 
-    const auto coinTypeQt = convertSwapCoinToCurrency(m_swapTx.getSwapCoin());
-    return calcWithdrawTxFee(coinTypeQt, *feeRate);
+        const auto coinTypeQt = convertSwapCoinToCurrency(m_swapTx.getSwapCoin());
+        return calcWithdrawTxFee(coinTypeQt, *feeRate);
+    });
 }
 
 QString SwapTxObject::getFailureReason() const
@@ -353,7 +376,12 @@ beam::wallet::AtomicSwapCoin SwapTxObject::getSwapCoinType() const
 
 auto SwapTxObject::getStatus() const -> QString
 {
-    return beam::wallet::GetSwapTxStatusStr(getTxDescription()).c_str();
+    return getStatusStr().c_str();
+}
+
+auto SwapTxObject::getStatusCode() const -> TxStatusCode
+{
+    return parseSwapTxStatus(getStatusStr());
 }
 
 namespace
@@ -401,12 +429,15 @@ namespace
 
 QString SwapTxObject::getToken() const
 {
-    auto swapToken = m_swapTx.getToken();
-    if (swapToken)
+    return m_token.get([this]()
     {
-        return QString::fromStdString(*swapToken);
-    }
-    return QString();
+        auto swapToken = m_swapTx.getToken();
+        if (swapToken)
+        {
+            return QString::fromStdString(*swapToken);
+        }
+        return QString();
+    });
 }
 
 bool SwapTxObject::isLockTxProofReceived() const
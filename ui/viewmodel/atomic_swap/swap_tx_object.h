@@ -50,6 +50,7 @@ public:
     QString getStateDetails() const override;
     beam::wallet::AtomicSwapCoin getSwapCoinType() const;
     auto getStatus() const -> QString override;
+    auto getStatusCode() const -> TxStatusCode override;
     QString getAmountWithCurrency() const;
 
     bool isLockTxProofReceived() const;
@@ -70,9 +71,18 @@ signals:
 private:
     auto getSwapAmountValue(bool sent) const -> beam::Amount;
     auto getSwapAmountWithCurrency(bool sent) const -> QString;
+    auto getStatusStr() const -> const std::string&;
 
     beam::wallet::SwapTxDescription m_swapTx;
     uint32_t m_lockTxMinConfirmations = 0;
     uint32_t m_withdrawTxMinConfirmations = 0;
     double m_blocksPerHour = 0;
+
+    LazyValue<std::string> m_statusStr;
+    LazyValue<QString> m_token;
+    LazyValue<QString> m_fee;
+    LazyValue<QString> m_swapCoinFeeRate;
+    LazyValue<QString> m_swapCoinFee;
+    LazyValue<QString> m_sentAmount;
+    LazyValue<QString> m_receivedAmount;
 };
@@ -104,9 +104,11 @@ auto SwapTxObjectList::data(const QModelIndex &index, int role) const -> QVarian
             return value->getAddressTo();
 
         case Roles::Status:
-        case Roles::StatusSort:
             return value->getStatus();
 
+        case Roles::StatusSort:
+            return value->getStatusCode().toInt();
+
         case Roles::Fee:
             return value->getFee();
 
@@ -245,3 +247,8 @@ auto SwapTxObjectList::data(const QModelIndex &index, int role) const -> QVarian
             return QVariant();
     }
 }
+
+auto SwapTxObjectList::getKey(const std::shared_ptr<SwapTxObject>& item) const -> beam::wallet::TxID
+{
+    return item->getTxID();
+}
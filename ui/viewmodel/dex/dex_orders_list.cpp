@@ -103,3 +103,8 @@ QVariant DexOrdersList::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 }
+
+std::string DexOrdersList::getKey(const beam::wallet::DexOrder& order) const
+{
+    return order.getID().to_string();
+}
@@ -15,7 +15,7 @@
 #include "viewmodel/helpers/list_model.h"
 #include "wallet/client/extensions/dex_board/dex_order.h"
 
-class DexOrdersList : public ListModel<beam::wallet::DexOrder>
+class DexOrdersList : public ListModel<beam::wallet::DexOrder, std::string>
 {
     Q_OBJECT
 public:
@@ -44,4 +44,7 @@ public:
 
     // TODO:DEX refactor and hide
     beam::PeerID selfID;
+
+protected:
+    [[nodiscard]] std::string getKey(const beam::wallet::DexOrder& order) const override;
 };
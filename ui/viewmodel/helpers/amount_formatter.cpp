@@ -0,0 +1,163 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "amount_formatter.h"
+#include <QLocale>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace
+{
+    struct LocaleSeparators
+    {
+        QChar point;
+        QChar group;
+    };
+
+    // the default locale is the system one and does not change while the app runs
+    const LocaleSeparators& getLocaleSeparators()
+    {
+        static const LocaleSeparators kSeparators = []()
+        {
+            const QLocale locale;
+            return LocaleSeparators{locale.decimalPoint(), locale.groupSeparator()};
+        }();
+        return kSeparators;
+    }
+}
+
+template <typename Char>
+Char* AmountFormatter::write(Char* end, beam::Amount value, uint8_t decimals, Char point, Char group)
+{
+    Char* p = end;
+    int fraction = std::min(decimals, kMaxDecimals);
+
+    // trailing zeros of the fraction are not shown
+    while (fraction > 0 && value % 10 == 0)
+    {
+        value /= 10;
+        --fraction;
+    }
+
+    if (fraction > 0)
+    {
+        for (int i = 0; i < fraction; ++i)
+        {
+            *--p = Char('0' + value % 10);
+            value /= 10;
+        }
+        *--p = point;
+    }
+
+    int digits = 0;
+    do
+    {
+        if (group != Char(0) && digits && digits % 3 == 0)
+        {
+            *--p = group;
+        }
+        *--p = Char('0' + value % 10);
+        value /= 10;
+        ++digits;
+    } while (value);
+
+    return p;
+}
+
+QString AmountFormatter::toUIString(beam::Amount value, uint8_t decimals)
+{
+    std::array<QChar, kBufferSize> buffer;
+    const auto end = buffer.data() + buffer.size();
+    const auto begin = write(end, value, decimals, QChar('.'), QChar(0));
+    return QString(begin, static_cast<int>(end - begin));
+}
+
+std::string AmountFormatter::toUIStdString(beam::Amount value, uint8_t decimals)
+{
+    std::array<char, kBufferSize> buffer;
+    const auto end = buffer.data() + buffer.size();
+    const auto begin = write(end, value, decimals, '.', '\0');
+    return std::string(begin, end);
+}
+
+QString AmountFormatter::toLocaleString(beam::Amount value, uint8_t decimals)
+{
+    const auto& separators = getLocaleSeparators();
+
+    std::array<QChar, kBufferSize> buffer;
+    const auto end = buffer.data() + buffer.size();
+    const auto begin = write(end, value, decimals, separators.point, separators.group);
+    return QString(begin, static_cast<int>(end - begin));
+}
+
+bool AmountFormatter::fromUIString(const QString& str, uint8_t decimals, beam::Amount& value)
+{
+    constexpr auto kMax = std::numeric_limits<beam::Amount>::max();
+
+    beam::Amount result = 0;
+    bool point = false;
+    int fraction = 0;
+
+    auto append = [&](int digit)
+    {
+        if (result > (kMax - digit) / 10)
+        {
+            return false;
+        }
+        result = result * 10 + digit;
+        return true;
+    };
+
+    for (const auto c : str)
+    {
+        if (c == QChar('.') && !point)
+        {
+            point = true;
+            continue;
+        }
+
+        if (c < QChar('0') || c > QChar('9'))
+        {
+            return false;
+        }
+
+        const int digit = c.unicode() - '0';
+        if (point && fraction == decimals)
+        {
+            // extra decimals would be lost
+            if (digit)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (!append(digit))
+        {
+            return false;
+        }
+        fraction += point ? 1 : 0;
+    }
+
+    for (; fraction < decimals; ++fraction)
+    {
+        if (!append(0))
+        {
+            return false;
+        }
+    }
+
+    value = result;
+    return true;
+}
@@ -0,0 +1,43 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <string>
+#include "core/block_crypt.h"
+
+//
+// Amount in coin quants <-> decimal text. Digits are written right to left into a stack buffer,
+// the only allocation is the returned string. UI form is "1234.5": "." separator, no grouping,
+// no trailing zeros. Locale form uses the separators of the default locale, read once
+//
+class AmountFormatter
+{
+public:
+    static constexpr uint8_t kMaxDecimals = 32;
+
+    [[nodiscard]] static QString toUIString(beam::Amount value, uint8_t decimals);
+    [[nodiscard]] static std::string toUIStdString(beam::Amount value, uint8_t decimals);
+    [[nodiscard]] static QString toLocaleString(beam::Amount value, uint8_t decimals);
+
+    // Accepts the UI form only. Fails on extra non zero decimals and on overflow, empty string is zero
+    [[nodiscard]] static bool fromUIString(const QString& str, uint8_t decimals, beam::Amount& value);
+
+private:
+    // 20 digits of uint64 with 19 group separators, the point and the fraction
+    static constexpr size_t kBufferSize = 40 + kMaxDecimals;
+
+    template <typename Char>
+    static Char* write(Char* end, beam::Amount value, uint8_t decimals, Char point, Char group);
+};
@@ -0,0 +1,153 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <QSet>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "core/block_crypt.h"
+#include "list_model.h"
+
+//
+// Asset ID -> rows of a ListModel, so asset metadata updates repaint only the rows showing that asset.
+// The index follows the row signals of the model by itself. Rows are remembered by key,
+// moves need no bookkeeping and keys are mapped to the current rows on lookup
+//
+template <typename T, typename Key>
+class AssetRowIndex
+{
+public:
+    using AssetIDs = std::vector<beam::Asset::ID>;
+    using GetAssets = std::function<void(const T& item, AssetIDs& assets)>;
+
+    AssetRowIndex(ListModel<T, Key>& model, GetAssets getAssets)
+        : m_model(model)
+        , m_getAssets(std::move(getAssets))
+    {
+        QObject::connect(&m_model, &QAbstractItemModel::rowsAboutToBeRemoved, &m_model, [this](const QModelIndex&, int first, int last)
+        {
+            for (int row = first; row <= last; ++row)
+            {
+                remove(m_model.keyAt(row));
+            }
+        });
+        QObject::connect(&m_model, &QAbstractItemModel::rowsInserted, &m_model, [this](const QModelIndex&, int first, int last)
+        {
+            add(first, last);
+        });
+        QObject::connect(&m_model, &QAbstractItemModel::modelReset, &m_model, [this]()
+        {
+            m_rows.clear();
+            m_assets.clear();
+            add(0, m_model.rowCount() - 1);
+        });
+        QObject::connect(&m_model, &QAbstractItemModel::dataChanged, &m_model, [this](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+        {
+            // role specific changes come only with items carrying the same data
+            if (roles.isEmpty())
+            {
+                add(topLeft.row(), bottomRight.row());
+            }
+        });
+    }
+
+    // Current rows showing the asset, unordered
+    [[nodiscard]] std::vector<int> getRows(beam::Asset::ID id) const
+    {
+        std::vector<int> rows;
+        auto it = m_rows.find(id);
+        if (it == m_rows.end())
+        {
+            return rows;
+        }
+
+        rows.reserve(it->second.size());
+        for (const auto& key : it->second)
+        {
+            if (const int row = m_model.indexOf(key); row >= 0)
+            {
+                rows.push_back(row);
+            }
+        }
+        return rows;
+    }
+
+    // Current rows showing any of the assets, a row showing several of them may repeat
+    [[nodiscard]] std::vector<int> getRows(const QSet<beam::Asset::ID>& ids) const
+    {
+        std::vector<int> rows;
+        for (auto id : ids)
+        {
+            const auto assetRows = getRows(id);
+            rows.insert(rows.end(), assetRows.begin(), assetRows.end());
+        }
+        return rows;
+    }
+
+private:
+    // (re)indexes the items of the rows, replaced items may show other assets
+    void add(int first, int last)
+    {
+        AssetIDs assets;
+        for (int row = first; row <= last && row < m_model.rowCount(); ++row)
+        {
+            const auto key = m_model.keyAt(row);
+            remove(key);
+
+            assets.clear();
+            m_getAssets(m_model.at(row), assets);
+            if (assets.empty())
+            {
+                continue;
+            }
+
+            for (auto id : assets)
+            {
+                m_rows[id].insert(key);
+            }
+            m_assets.emplace(key, assets);
+        }
+    }
+
+    void remove(const Key& key)
+    {
+        auto it = m_assets.find(key);
+        if (it == m_assets.end())
+        {
+            return;
+        }
+
+        for (auto id : it->second)
+        {
+            if (auto rows = m_rows.find(id); rows != m_rows.end())
+            {
+                rows->second.erase(key);
+                if (rows->second.empty())
+                {
+                    m_rows.erase(rows);
+                }
+            }
+        }
+        m_assets.erase(it);
+    }
+
+    ListModel<T, Key>& m_model;
+    GetAssets m_getAssets;
+    std::unordered_map<beam::Asset::ID, std::unordered_set<Key, ListModelKeyHash>> m_rows;
+    std::unordered_map<Key, AssetIDs, ListModelKeyHash> m_assets;
+};
@@ -0,0 +1,228 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fixed_amount.h"
+#include <array>
+#include <stdexcept>
+
+namespace
+{
+    // 10^38 is the largest power that fits
+    constexpr unsigned int kMaxPow10 = 38;
+}
+
+FixedAmount::FixedAmount(Value value, uint8_t decimals)
+    : m_value(std::move(value))
+    , m_decimals(decimals)
+{
+}
+
+std::optional<FixedAmount> FixedAmount::fromString(const std::string& str)
+{
+    size_t pos = 0;
+    const bool negative = !str.empty() && str[0] == '-';
+    if (negative)
+    {
+        ++pos;
+    }
+
+    try
+    {
+        Value value = 0;
+        uint8_t decimals = 0;
+        bool point = false;
+        bool digits = false;
+        bool dropped = false;
+        bool roundUp = false;
+
+        for (; pos < str.size(); ++pos)
+        {
+            const char c = str[pos];
+            if (c == '.' && !point)
+            {
+                point = true;
+                continue;
+            }
+
+            if (c < '0' || c > '9')
+            {
+                return std::nullopt;
+            }
+
+            digits = true;
+            if (point && decimals == kMaxDecimals)
+            {
+                // only the first dropped digit matters for half up
+                if (!dropped)
+                {
+                    roundUp = c >= '5';
+                    dropped = true;
+                }
+                continue;
+            }
+
+            value = value * 10 + (c - '0');
+            if (point)
+            {
+                ++decimals;
+            }
+        }
+
+        if (!digits)
+        {
+            return std::nullopt;
+        }
+
+        if (roundUp)
+        {
+            ++value;
+        }
+
+        return FixedAmount(negative ? Value(-value) : value, decimals);
+    }
+    catch (const std::overflow_error&)
+    {
+        return std::nullopt;
+    }
+}
+
+std::optional<FixedAmount> FixedAmount::rescale(uint8_t decimals, Rounding rounding) const
+{
+    try
+    {
+        if (decimals >= m_decimals)
+        {
+            return FixedAmount(m_value * pow10(decimals - m_decimals), decimals);
+        }
+        return FixedAmount(divideRounded(m_value, pow10(m_decimals - decimals), rounding), decimals);
+    }
+    catch (const std::overflow_error&)
+    {
+        return std::nullopt;
+    }
+}
+
+std::optional<FixedAmount> FixedAmount::multiply(const FixedAmount& other, uint8_t decimals, Rounding rounding) const
+{
+    try
+    {
+        const FixedAmount product(m_value * other.m_value, m_decimals + other.m_decimals);
+        return product.rescale(decimals, rounding);
+    }
+    catch (const std::overflow_error&)
+    {
+        return std::nullopt;
+    }
+}
+
+std::optional<FixedAmount> FixedAmount::divide(const FixedAmount& other, uint8_t decimals, Rounding rounding) const
+{
+    if (other.m_value == 0)
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        // result * 10^decimals = value * 10^(decimals + other.decimals - this.decimals) / other.value
+        const int shift = int(decimals) + other.m_decimals - m_decimals;
+        const Value dividend = shift > 0 ? Value(m_value * pow10(shift)) : m_value;
+        const Value divider = shift < 0 ? Value(other.m_value * pow10(-shift)) : other.m_value;
+        return FixedAmount(divideRounded(dividend, divider, rounding), decimals);
+    }
+    catch (const std::overflow_error&)
+    {
+        return std::nullopt;
+    }
+}
+
+std::string FixedAmount::toString() const
+{
+    const bool negative = m_value < 0;
+    std::string digits = negative ? Value(-m_value).str() : m_value.str();
+
+    if (digits.size() <= m_decimals)
+    {
+        digits.insert(0, m_decimals - digits.size() + 1, '0');
+    }
+
+    std::string result;
+    result.reserve(digits.size() + 2);
+    if (negative)
+    {
+        result.push_back('-');
+    }
+
+    const size_t whole = digits.size() - m_decimals;
+    result.append(digits, 0, whole);
+
+    auto fractionEnd = digits.find_last_not_of('0');
+    if (fractionEnd != std::string::npos && fractionEnd >= whole)
+    {
+        result.push_back('.');
+        result.append(digits, whole, fractionEnd - whole + 1);
+    }
+
+    return result;
+}
+
+const FixedAmount::Value& FixedAmount::getValue() const
+{
+    return m_value;
+}
+
+uint8_t FixedAmount::getDecimals() const
+{
+    return m_decimals;
+}
+
+FixedAmount::Value FixedAmount::pow10(unsigned int n)
+{
+    static const auto kPowers = []()
+    {
+        std::array<Value, kMaxPow10 + 1> powers;
+        powers[0] = 1;
+        for (size_t i = 1; i < powers.size(); ++i)
+        {
+            powers[i] = powers[i - 1] * 10;
+        }
+        return powers;
+    }();
+
+    if (n > kMaxPow10)
+    {
+        throw std::overflow_error("FixedAmount: power of ten out of range");
+    }
+    return kPowers[n];
+}
+
+FixedAmount::Value FixedAmount::divideRounded(const Value& dividend, const Value& divider, Rounding rounding)
+{
+    // both truncate toward zero, the remainder takes the sign of the dividend
+    Value quotient = dividend / divider;
+    const Value remainder = dividend % divider;
+    if (remainder == 0 || rounding == Rounding::Down)
+    {
+        return quotient;
+    }
+
+    const Value absRemainder = remainder < 0 ? Value(-remainder) : remainder;
+    const Value absDivider = divider < 0 ? Value(-divider) : divider;
+    const bool away = rounding == Rounding::Up || absRemainder >= absDivider - absRemainder;
+    if (away)
+    {
+        const bool negative = (dividend < 0) != (divider < 0);
+        quotient += negative ? -1 : 1;
+    }
+    return quotient;
+}
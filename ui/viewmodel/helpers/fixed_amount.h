@@ -0,0 +1,63 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <optional>
+#include <string>
+#include <boost/multiprecision/cpp_int.hpp>
+
+//
+// Decimal number kept as an integer count of 10^-decimals.
+// Arithmetic is exact in 128 bits and every result is rounded once, to the decimals asked for.
+// Values that do not fit give std::nullopt instead of wrapping around
+//
+class FixedAmount
+{
+public:
+    using Value = boost::multiprecision::checked_int128_t;
+
+    enum class Rounding
+    {
+        Down,   // toward zero
+        Up,     // away from zero
+        HalfUp  // to nearest, ties away from zero
+    };
+
+    // Parsed fractions longer than that are rounded half up
+    static constexpr uint8_t kMaxDecimals = 18;
+
+    FixedAmount() = default;
+    FixedAmount(Value value, uint8_t decimals);
+
+    // "[-]123[.456]", std::nullopt for anything else
+    [[nodiscard]] static std::optional<FixedAmount> fromString(const std::string& str);
+
+    [[nodiscard]] std::optional<FixedAmount> rescale(uint8_t decimals, Rounding rounding) const;
+    [[nodiscard]] std::optional<FixedAmount> multiply(const FixedAmount& other, uint8_t decimals, Rounding rounding) const;
+    // std::nullopt on zero divider as well
+    [[nodiscard]] std::optional<FixedAmount> divide(const FixedAmount& other, uint8_t decimals, Rounding rounding) const;
+
+    // No trailing zeros in the fraction and no point for whole numbers
+    [[nodiscard]] std::string toString() const;
+
+    [[nodiscard]] const Value& getValue() const;
+    [[nodiscard]] uint8_t getDecimals() const;
+
+private:
+    static Value pow10(unsigned int n);
+    static Value divideRounded(const Value& dividend, const Value& divider, Rounding rounding);
+
+    Value m_value = 0;
+    uint8_t m_decimals = 0;
+};
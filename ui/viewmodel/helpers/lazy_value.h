@@ -0,0 +1,38 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+
+//
+// Value computed on the first access and kept afterwards, usable from const getters
+//
+template <typename T>
+class LazyValue
+{
+public:
+    template <typename Compute>
+    const T& get(Compute&& compute) const
+    {
+        if (!m_value)
+        {
+            m_value.emplace(compute());
+        }
+        return *m_value;
+    }
+
+private:
+    mutable std::optional<T> m_value;
+};
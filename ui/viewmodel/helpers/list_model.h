@@ -14,28 +14,46 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <QAbstractListModel>
+#include <QVector>
 Q_DECLARE_METATYPE(QModelIndex)
-template <typename T>
-class ListModel : public QAbstractListModel
+
+// Hashes list keys. Integral and string keys go through std::hash,
+// anything else (TxID, uintBig and friends) is hashed as a plain byte blob
+struct ListModelKeyHash
 {
-    template<typename Y>
-    struct Comparator
+    template<typename K>
+    size_t operator()(const K& key) const
     {
-        const Y& value;
-        Comparator(const Y& v) : value{ v } {}
-        constexpr bool operator()(const Y& other) { return value == other; }
-    };
+        if constexpr (std::is_integral_v<K> || std::is_same_v<K, std::string>)
+        {
+            return std::hash<K>()(key);
+        }
+        else
+        {
+            return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(&key), sizeof(K)));
+        }
+    }
+};
 
-    template<typename Y>
-    struct Comparator<std::shared_ptr<Y>>
-    {
-        std::shared_ptr<Y> value;
-        Comparator(const std::shared_ptr<Y>& v) : value{ v } {}
-        constexpr bool operator()(const std::shared_ptr<Y>& other) { return *value == *other; }
-    };
+//
+// List model with a key -> row index.
+// Subclasses provide getKey() for their items (TxID, coin ID, notification ID...),
+// update/remove become hash lookups and all row signals are coalesced into contiguous ranges
+//
+template <typename T, typename Key>
+class ListModel : public QAbstractListModel
+{
 public:
     ListModel(QObject* pObj = nullptr)
         : QAbstractListModel(pObj)
@@ -53,44 +71,216 @@ public:
 
     void insert(const T& item)
     {
-        int row = m_list.size();
-        beginInsertRows(QModelIndex(), row,row + 1);
-        m_list.push_back(item);
-        endInsertRows();
+        insert(std::vector<T>{item});
     }
 
     void insert_at(const T& item, int index)
     {
+        if (int row = indexOf(getKey(item)); row >= 0)
+        {
+            m_list[row] = item;
+            touch(row);
+            return;
+        }
+
+        index = std::clamp(index, 0, m_list.size());
         beginInsertRows(QModelIndex(), index, index);
-        auto at = m_list.begin();
-        std::advance(at, index);
-        m_list.insert(at, item);
+        m_list.insert(index, item);
+        reindex(index);
         endInsertRows();
     }
 
+    // Items with already known keys are updated in place, the rest are appended as a single range
     void insert(const std::vector<T>& items)
     {
-        if (items.size() == 0)
+        std::vector<T> added;
+        ChangedRows changed;
+        added.reserve(items.size());
+
+        for (const auto& item : items)
         {
+            if (auto it = m_index.find(getKey(item)); it != m_index.end())
+            {
+                if (it->second >= m_list.size())
+                {
+                    // duplicate within this batch
+                    added[it->second - m_list.size()] = item;
+                    continue;
+                }
+                changed[getChangedRoles(m_list[it->second], item)].push_back(it->second);
+                m_list[it->second] = item;
+            }
+            else
+            {
+                m_index.emplace(getKey(item), m_list.size() + int(added.size()));
+                added.push_back(item);
+            }
+        }
+
+        if (!added.empty())
+        {
+            int row = m_list.size();
+            beginInsertRows(QModelIndex(), row, row + int(added.size()) - 1);
+            m_list.reserve(m_list.size() + int(added.size()));
+            for (auto& item : added)
+            {
+                m_list.push_back(std::move(item));
+            }
+            endInsertRows();
+        }
+
+        emitDataChanged(std::move(changed));
+    }
+
+    // Brings the model to the given contents with the minimal set of row signals,
+    // rows that survive keep their delegates. Full model reset is used when there is nothing to preserve
+    // or when the rows are reordered so much that moving them one by one costs more than rebuilding
+    void reset(const std::vector<T>& items)
+    {
+        if (m_list.isEmpty() || items.empty())
+        {
+            resetModel(items);
             return;
         }
-        int row = m_list.size();
-        beginInsertRows(QModelIndex(), row, row + int(items.size()) - 1);
+
+        std::vector<const T*> target;
+        std::unordered_map<Key, size_t, ListModelKeyHash> targetIndex;
+        target.reserve(items.size());
+        targetIndex.reserve(items.size());
         for (const auto& item : items)
         {
-            m_list.push_back(item);
+            if (auto [it, inserted] = targetIndex.emplace(getKey(item), target.size()); !inserted)
+            {
+                target[it->second] = &item;
+                continue;
+            }
+            target.push_back(&item);
         }
-        endInsertRows();
+
+        // survivors in the current order, as their target rows
+        std::vector<int> removed;
+        std::vector<size_t> survivors;
+        for (int row = 0; row < m_list.size(); ++row)
+        {
+            if (auto it = targetIndex.find(getKey(m_list[row])); it != targetIndex.end())
+            {
+                survivors.push_back(it->second);
+            }
+            else
+            {
+                removed.push_back(row);
+            }
+        }
+
+        // dry run of the loop below, counting the moves and insert runs it would signal
+        std::vector<bool> moved(target.size(), false);
+        size_t next = 0;
+        int batches = 0;
+        bool inserting = false;
+        for (size_t pos = 0; pos < target.size(); ++pos)
+        {
+            if (!contains(getKey(*target[pos])))
+            {
+                batches += inserting ? 0 : 1;
+                inserting = true;
+                continue;
+            }
+
+            inserting = false;
+            while (next < survivors.size() && moved[survivors[next]])
+            {
+                ++next;
+            }
+            if (next < survivors.size() && survivors[next] == pos)
+            {
+                ++next;
+            }
+            else
+            {
+                moved[pos] = true;
+                ++batches;
+            }
+        }
+
+        if (batches > kMaxResetBatches)
+        {
+            resetModel(items);
+            return;
+        }
+
+        removeRows(std::move(removed));
+
+        // rows above 'row' are final, everything below is either a survivor or not inserted yet
+        ChangedRows changed;
+        const int count = int(target.size());
+        for (int row = 0; row < count;)
+        {
+            const auto& item = *target[row];
+            const auto key = getKey(item);
+
+            if (!contains(key))
+            {
+                int last = row;
+                while (last + 1 < count && !contains(getKey(*target[last + 1])))
+                {
+                    ++last;
+                }
+
+                beginInsertRows(QModelIndex(), row, last);
+                auto tail = m_list.mid(row);
+                m_list.erase(m_list.begin() + row, m_list.end());
+                for (int i = row; i <= last; ++i)
+                {
+                    m_list.push_back(*target[i]);
+                }
+                m_list.append(tail);
+                endInsertRows();
+
+                row = last + 1;
+                continue;
+            }
+
+            if (!(getKey(m_list[row]) == key))
+            {
+                int from = row + 1;
+                while (!(getKey(m_list[from]) == key))
+                {
+                    ++from;
+                }
+                beginMoveRows(QModelIndex(), from, from, QModelIndex(), row);
+                m_list.move(from, row);
+                endMoveRows();
+            }
+
+            if (hasChanged(m_list[row], item))
+            {
+                changed[getChangedRoles(m_list[row], item)].push_back(row);
+            }
+            m_list[row] = item;
+            ++row;
+        }
+
+        m_index.clear();
+        reindex();
+        emitDataChanged(std::move(changed));
     }
 
-    void reset(const std::vector<T>& items)
+    // Drops everything and rebuilds the model, all delegates are recreated
+    void resetModel(const std::vector<T>& items)
     {
-        int row = 0;
         beginResetModel();
         m_list.clear();
+        m_index.clear();
+        m_list.reserve(int(items.size()));
+        m_index.reserve(items.size());
         for (const auto& item : items)
         {
-            m_list.insert(row, item);
+            if (auto [it, inserted] = m_index.emplace(getKey(item), m_list.size()); !inserted)
+            {
+                m_list[it->second] = item;
+                continue;
+            }
+            m_list.push_back(item);
         }
         endResetModel();
     }
@@ -100,44 +290,45 @@ public:
         return m_list.at(index);
     }
 
+    const T& at(int index) const
+    {
+        return m_list.at(index);
+    }
+
+    Key keyAt(int index) const
+    {
+        return getKey(m_list.at(index));
+    }
+
+    int indexOf(const Key& key) const
+    {
+        auto it = m_index.find(key);
+        return it != m_index.end() ? it->second : -1;
+    }
+
+    bool contains(const Key& key) const
+    {
+        return m_index.find(key) != m_index.end();
+    }
+
     void remove(const std::vector<T>& items)
     {
+        std::vector<int> rows;
+        rows.reserve(items.size());
         for (const auto& item : items)
         {
-            auto it = std::find_if(std::begin(m_list), std::end(m_list), Comparator<T>(item));
-
-            if (it != std::end(m_list))
+            if (auto it = m_index.find(getKey(item)); it != m_index.end())
             {
-                auto index = m_list.indexOf(*it);
-                beginRemoveRows(QModelIndex(), index, index);
-                m_list.removeAt(index);
-                endRemoveRows();
+                rows.push_back(it->second);
             }
         }
+        removeRows(std::move(rows));
     }
 
+    // Known items are replaced in place and reported with dataChanged, unknown ones are appended
     void update(const std::vector<T>& items)
     {
-        for (const auto& item : items)
-        {
-            auto it = std::find_if(std::begin(m_list), std::end(m_list), Comparator<T>(item));
-
-            // index to add item on last position by default
-            int index = (m_list.count() == 0) ? 0 : m_list.count() - 1;
-
-            if (it != std::end(m_list))
-            {
-                index = m_list.indexOf(*it);
-
-                beginRemoveRows(QModelIndex(), index, index);
-                m_list.removeAt(index);
-                endRemoveRows();
-            }
-
-            beginInsertRows(QModelIndex(), index, index);
-            m_list.insert(index, item);
-            endInsertRows();
-        }
+        insert(items);
     }
 
     auto begin()
@@ -150,7 +341,8 @@ public:
         return m_list.end();
     }
 
-    bool touch(int index)
+    // Repaints a row, only the given roles if any, so that views re-evaluate just the bindings depending on them
+    bool touch(int index, const QVector<int>& roles = QVector<int>())
     {
         if (index < 0 || index >= m_list.size())
         {
@@ -158,10 +350,101 @@ public:
         }
 
         const auto qindex = createIndex(index, 0);
-        emit dataChanged(qindex, qindex);
+        emit dataChanged(qindex, qindex, roles);
         return true;
     }
 
 protected:
-    QList<T> m_list;
+    virtual Key getKey(const T& item) const = 0;
+
+    // Tells reset() whether a surviving row has to be repainted
+    virtual bool hasChanged(const T& /*prev*/, const T& /*next*/) const
+    {
+        return true;
+    }
+
+    // Roles to report when an item is replaced with a newer version of itself, empty for all of them.
+    // A non empty list is allowed only when the item data is the same, row indexes rebuild on empty ones only
+    virtual QVector<int> getChangedRoles(const T& /*prev*/, const T& /*next*/) const
+    {
+        return QVector<int>();
+    }
+
+    // changed rows grouped by the roles they report
+    using ChangedRows = std::map<QVector<int>, std::vector<int>>;
+
+    void emitDataChanged(ChangedRows changed)
+    {
+        for (auto& [roles, rows] : changed)
+        {
+            emitDataChanged(std::move(rows), roles);
+        }
+    }
+
+    // Removes rows from the tail so that lower rows stay valid, one signal per contiguous block
+    void removeRows(std::vector<int> rows)
+    {
+        if (rows.empty())
+        {
+            return;
+        }
+
+        std::sort(rows.begin(), rows.end(), std::greater<int>());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        for (size_t i = 0; i < rows.size();)
+        {
+            const int last = rows[i];
+            int first = last;
+            while (++i < rows.size() && rows[i] == first - 1)
+            {
+                first = rows[i];
+            }
+
+            beginRemoveRows(QModelIndex(), first, last);
+            for (int row = first; row <= last; ++row)
+            {
+                m_index.erase(getKey(m_list[row]));
+            }
+            m_list.erase(m_list.begin() + first, m_list.begin() + last + 1);
+            endRemoveRows();
+        }
+
+        reindex(rows.back());
+    }
+
+    // Emits one dataChanged per contiguous block of rows
+    void emitDataChanged(std::vector<int> rows, const QVector<int>& roles = QVector<int>())
+    {
+        if (rows.empty())
+        {
+            return;
+        }
+
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        for (size_t i = 0; i < rows.size();)
+        {
+            const int first = rows[i];
+            int last = first;
+            while (++i < rows.size() && rows[i] == last + 1)
+            {
+                last = rows[i];
+            }
+            emit dataChanged(createIndex(first, 0), createIndex(last, 0), roles);
+        }
+    }
+
+    void reindex(int from = 0)
+    {
+        for (int row = from; row < m_list.size(); ++row)
+        {
+            m_index[getKey(m_list[row])] = row;
+        }
+    }
+
+    // reset() falls back to resetModel() above this many moves and insert runs, each costs a pass over the list
+    static constexpr int kMaxResetBatches = 32;
+
+    QVector<T> m_list;
+    std::unordered_map<Key, int, ListModelKeyHash> m_index;
 };
@@ -0,0 +1,121 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "core/block_crypt.h"
+#include "list_model.h"
+
+//
+// Rows of a ListModel showing values that depend on the current height.
+// Every item tells the first height at which its display changes, 0 if it never does.
+// On a new block takeDue() returns only the rows whose height has come and asks them for the next one.
+// The schedule follows the row signals of the model by itself, like AssetRowIndex
+//
+template <typename T, typename Key>
+class RefreshSchedule
+{
+public:
+    using GetRefreshHeight = std::function<beam::Height(const T& item)>;
+
+    RefreshSchedule(ListModel<T, Key>& model, GetRefreshHeight getRefreshHeight)
+        : m_model(model)
+        , m_getRefreshHeight(std::move(getRefreshHeight))
+    {
+        QObject::connect(&m_model, &QAbstractItemModel::rowsAboutToBeRemoved, &m_model, [this](const QModelIndex&, int first, int last)
+        {
+            for (int row = first; row <= last; ++row)
+            {
+                cancel(m_model.keyAt(row));
+            }
+        });
+        QObject::connect(&m_model, &QAbstractItemModel::rowsInserted, &m_model, [this](const QModelIndex&, int first, int last)
+        {
+            schedule(first, last);
+        });
+        QObject::connect(&m_model, &QAbstractItemModel::modelReset, &m_model, [this]()
+        {
+            m_queue.clear();
+            m_entries.clear();
+            schedule(0, m_model.rowCount() - 1);
+        });
+        QObject::connect(&m_model, &QAbstractItemModel::dataChanged, &m_model, [this](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+        {
+            if (roles.isEmpty())
+            {
+                schedule(topLeft.row(), bottomRight.row());
+            }
+        });
+    }
+
+    // Rows to repaint at this height, they are rescheduled right away
+    [[nodiscard]] std::vector<int> takeDue(beam::Height height)
+    {
+        std::vector<Key> due;
+        while (!m_queue.empty() && m_queue.begin()->first <= height)
+        {
+            due.push_back(m_queue.begin()->second);
+            m_entries.erase(m_queue.begin()->second);
+            m_queue.erase(m_queue.begin());
+        }
+
+        std::vector<int> rows;
+        rows.reserve(due.size());
+        for (const auto& key : due)
+        {
+            if (const int row = m_model.indexOf(key); row >= 0)
+            {
+                rows.push_back(row);
+                schedule(row, row);
+            }
+        }
+        return rows;
+    }
+
+private:
+    void schedule(int first, int last)
+    {
+        for (int row = first; row <= last && row < m_model.rowCount(); ++row)
+        {
+            const auto key = m_model.keyAt(row);
+            cancel(key);
+
+            if (const auto height = m_getRefreshHeight(m_model.at(row)); height)
+            {
+                m_entries.emplace(key, m_queue.emplace(height, key));
+            }
+        }
+    }
+
+    void cancel(const Key& key)
+    {
+        if (auto it = m_entries.find(key); it != m_entries.end())
+        {
+            m_queue.erase(it->second);
+            m_entries.erase(it);
+        }
+    }
+
+    using Queue = std::multimap<beam::Height, Key>;
+
+    ListModel<T, Key>& m_model;
+    GetRefreshHeight m_getRefreshHeight;
+    Queue m_queue;
+    std::unordered_map<Key, typename Queue::iterator, ListModelKeyHash> m_entries;
+};
@@ -0,0 +1,233 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <QString>
+#include "list_model.h"
+
+//
+// Substring search index over case folded texts, keyed like the list models.
+// Every text is split into trigrams, a query is answered from the shortest posting list
+// of its trigrams and each candidate is verified, so results are exact.
+// Removed entries are dropped from the postings lazily, the index compacts itself
+// when stale postings outnumber the live ones
+//
+template <typename Key>
+class SearchIndex
+{
+public:
+    using KeySet = std::unordered_set<Key, ListModelKeyHash>;
+
+    static QString normalize(const QString& text)
+    {
+        return text.toCaseFolded();
+    }
+
+    void insert(const Key& key, const QString& text)
+    {
+        auto folded = normalize(text);
+        if (auto it = m_slots.find(key); it != m_slots.end())
+        {
+            auto& entry = m_entries[it->second];
+            if (entry.text == folded)
+            {
+                return;
+            }
+            retire(entry.text);
+            entry.text = std::move(folded);
+            addPostings(it->second);
+            compactIfStale();
+            return;
+        }
+
+        uint32_t slot = 0;
+        if (!m_free.empty())
+        {
+            slot = m_free.back();
+            m_free.pop_back();
+            m_entries[slot] = Entry{key, std::move(folded), true};
+        }
+        else
+        {
+            slot = uint32_t(m_entries.size());
+            m_entries.push_back(Entry{key, std::move(folded), true});
+        }
+        m_slots.emplace(key, slot);
+        addPostings(slot);
+    }
+
+    void remove(const Key& key)
+    {
+        auto it = m_slots.find(key);
+        if (it == m_slots.end())
+        {
+            return;
+        }
+
+        auto& entry = m_entries[it->second];
+        retire(entry.text);
+        entry.alive = false;
+        entry.text.clear();
+        m_free.push_back(it->second);
+        m_slots.erase(it);
+        compactIfStale();
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_free.clear();
+        m_slots.clear();
+        m_postings.clear();
+        m_live = 0;
+        m_stale = 0;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return m_slots.size();
+    }
+
+    // Keys whose text contains the query, all keys for an empty query
+    [[nodiscard]] KeySet find(const QString& query) const
+    {
+        const auto folded = normalize(query);
+        KeySet result;
+
+        if (folded.size() < kGramSize)
+        {
+            // too short for the index, plain scan over the folded texts
+            for (const auto& entry : m_entries)
+            {
+                if (entry.alive && entry.text.contains(folded))
+                {
+                    result.insert(entry.key);
+                }
+            }
+            return result;
+        }
+
+        const std::vector<uint32_t>* shortest = nullptr;
+        for (int i = 0; i + kGramSize <= folded.size(); ++i)
+        {
+            auto it = m_postings.find(getTrigram(folded, i));
+            if (it == m_postings.end())
+            {
+                return result;
+            }
+            if (!shortest || it->second.size() < shortest->size())
+            {
+                shortest = &it->second;
+            }
+        }
+
+        for (auto slot : *shortest)
+        {
+            const auto& entry = m_entries[slot];
+            if (entry.alive && entry.text.contains(folded))
+            {
+                result.insert(entry.key);
+            }
+        }
+        return result;
+    }
+
+    // Checks a single key, the query has to be normalized already
+    [[nodiscard]] bool matches(const Key& key, const QString& normalizedQuery) const
+    {
+        auto it = m_slots.find(key);
+        return it != m_slots.end() && m_entries[it->second].text.contains(normalizedQuery);
+    }
+
+private:
+    static constexpr int kGramSize = 3;
+
+    struct Entry
+    {
+        Key key;
+        QString text;
+        bool alive = false;
+    };
+
+    static uint64_t getTrigram(const QString& text, int pos)
+    {
+        return (uint64_t(text[pos].unicode()) << 32) | (uint64_t(text[pos + 1].unicode()) << 16) | text[pos + 2].unicode();
+    }
+
+    static size_t countTrigrams(const QString& text)
+    {
+        return text.size() < kGramSize ? 0 : size_t(text.size() - kGramSize + 1);
+    }
+
+    void addPostings(uint32_t slot)
+    {
+        const auto& text = m_entries[slot].text;
+        std::vector<uint64_t> grams;
+        grams.reserve(countTrigrams(text));
+        for (int i = 0; i + kGramSize <= text.size(); ++i)
+        {
+            grams.push_back(getTrigram(text, i));
+        }
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+
+        for (auto gram : grams)
+        {
+            m_postings[gram].push_back(slot);
+        }
+        m_live += countTrigrams(text);
+    }
+
+    // postings of the old text stay in place, candidates are verified anyway
+    void retire(const QString& text)
+    {
+        const auto count = countTrigrams(text);
+        m_live -= count;
+        m_stale += count;
+    }
+
+    void compactIfStale()
+    {
+        if (m_stale <= m_live)
+        {
+            return;
+        }
+
+        m_postings.clear();
+        m_live = 0;
+        m_stale = 0;
+        for (uint32_t slot = 0; slot < m_entries.size(); ++slot)
+        {
+            if (m_entries[slot].alive)
+            {
+                addPostings(slot);
+            }
+        }
+    }
+
+    std::vector<Entry> m_entries;
+    std::vector<uint32_t> m_free;
+    std::unordered_map<Key, uint32_t, ListModelKeyHash> m_slots;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_postings;
+
+    // posting counters driving the compaction
+    size_t m_live = 0;
+    size_t m_stale = 0;
+};
@@ -13,6 +13,47 @@
 // limitations under the License.
 
 #include "sortfilterproxymodel.h"
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThreadPool>
+#include <algorithm>
+#include <functional>
+
+namespace
+{
+    // below this the filter is matched row by row as the base proxy asks
+    const int kParallelFilterRows = 20000;
+
+    // moves [start, end] before row, the way rowsMoved does it within one parent
+    template <typename T>
+    void moveRange(std::vector<T> &values, int start, int end, int row)
+    {
+        if (row > end + 1)
+            std::rotate(values.begin() + start, values.begin() + end + 1, values.begin() + row);
+        else if (row < start)
+            std::rotate(values.begin() + row, values.begin() + start, values.begin() + end + 1);
+    }
+
+    class FilterChunk : public QRunnable
+    {
+    public:
+        FilterChunk(std::function<void()> job, QSemaphore &done)
+            : m_job(std::move(job))
+            , m_done(done)
+        {
+        }
+
+        void run() override
+        {
+            m_job();
+            m_done.release();
+        }
+
+    private:
+        std::function<void()> m_job;
+        QSemaphore &m_done;
+    };
+}
 
 SortFilterProxyModel::SortFilterProxyModel(QObject *parent) 
     : QSortFilterProxyModel(parent)
@@ -39,6 +80,35 @@ void SortFilterProxyModel::setSource(QObject *source)
     setSourceModel(qobject_cast<QAbstractItemModel *>(source));
 }
 
+void SortFilterProxyModel::setSourceModel(QAbstractItemModel *model)
+{
+    if (QAbstractItemModel *prev = sourceModel()) {
+        disconnect(prev, &QAbstractItemModel::rowsInserted, this, &SortFilterProxyModel::onSourceRowsInserted);
+        disconnect(prev, &QAbstractItemModel::rowsRemoved, this, &SortFilterProxyModel::onSourceRowsRemoved);
+        disconnect(prev, &QAbstractItemModel::rowsMoved, this, &SortFilterProxyModel::onSourceRowsMoved);
+        disconnect(prev, &QAbstractItemModel::dataChanged, this, &SortFilterProxyModel::onSourceDataChanged);
+        disconnect(prev, &QAbstractItemModel::modelReset, this, &SortFilterProxyModel::onSourceReset);
+        disconnect(prev, &QAbstractItemModel::layoutChanged, this, &SortFilterProxyModel::onSourceReset);
+    }
+
+    // connected first, so the keys are patched before the base proxy re-sorts the rows
+    if (model) {
+        connect(model, &QAbstractItemModel::rowsInserted, this, &SortFilterProxyModel::onSourceRowsInserted);
+        connect(model, &QAbstractItemModel::rowsRemoved, this, &SortFilterProxyModel::onSourceRowsRemoved);
+        connect(model, &QAbstractItemModel::rowsMoved, this, &SortFilterProxyModel::onSourceRowsMoved);
+        connect(model, &QAbstractItemModel::dataChanged, this, &SortFilterProxyModel::onSourceDataChanged);
+        connect(model, &QAbstractItemModel::modelReset, this, &SortFilterProxyModel::onSourceReset);
+        connect(model, &QAbstractItemModel::layoutChanged, this, &SortFilterProxyModel::onSourceReset);
+    }
+
+    m_sortKeys.clear();
+    m_sortKeyValid.clear();
+    m_accepted.clear();
+    updateRoleIds(model);
+    QSortFilterProxyModel::setSourceModel(model);
+    resetSortKeys();
+}
+
 QByteArray SortFilterProxyModel::sortRole() const
 {
     return m_sortRole;
@@ -48,8 +118,11 @@ void SortFilterProxyModel::setSortRole(const QByteArray &role)
 {
     if (m_sortRole != role) {
         m_sortRole = role;
-        if (m_complete)
+        if (m_complete) {
+            updateSortRoleId();
+            resetSortKeys();
             QSortFilterProxyModel::setSortRole(roleKey(role));
+        }
     }
 }
 
@@ -67,6 +140,7 @@ void SortFilterProxyModel::setFilterRole(const QByteArray &role)
 {
     if (m_filterRole != role) {
         m_filterRole = role;
+        prepareFilter(filterString(), filterSyntax());
         if (m_complete)
             QSortFilterProxyModel::setFilterRole(roleKey(role));
     }
@@ -79,6 +153,7 @@ QString SortFilterProxyModel::filterString() const
 
 void SortFilterProxyModel::setFilterString(const QString &filter)
 {
+    prepareFilter(filter, filterSyntax());
     setFilterRegExp(QRegExp(filter, filterCaseSensitivity(), static_cast<QRegExp::PatternSyntax>(filterSyntax())));
 }
 
@@ -89,36 +164,25 @@ SortFilterProxyModel::FilterSyntax SortFilterProxyModel::filterSyntax() const
 
 void SortFilterProxyModel::setFilterSyntax(SortFilterProxyModel::FilterSyntax syntax)
 {
+    prepareFilter(filterString(), syntax);
     setFilterRegExp(QRegExp(filterString(), filterCaseSensitivity(), static_cast<QRegExp::PatternSyntax>(syntax)));
 }
 
 QVariantMap SortFilterProxyModel::get(int idx) const
 {
-	QVariantMap map;
+    QVariantMap map;
     if (idx >= 0 && idx < count()) {
-        QHash<int, QByteArray> roles = roleNames();
-        QHashIterator<int, QByteArray> it(roles);
-        while (it.hasNext()) {
-            it.next();
-			auto roleName = QString::fromUtf8(it.value());
-			map[roleName] = data(index(idx, 0), it.key());
-        }
+        const QModelIndex proxyIndex = index(idx, 0);
+        for (auto it = m_roleIds.cbegin(); it != m_roleIds.cend(); ++it)
+            map[QString::fromUtf8(it.key())] = data(proxyIndex, it.value());
     }
     return map;
 }
 
 QVariant SortFilterProxyModel::getRoleValue(int idx, QByteArray roleName) const
 {
-    QHash<int, QByteArray> roles = roleNames();
-    QHashIterator<int, QByteArray> it(roles);
-    while (it.hasNext()) {
-        it.next();
-        if (roleName == it.value())
-        {
-            return data(index(idx, 0), it.key());
-        }
-    }
-    return QVariant();
+    const int role = roleKey(roleName);
+    return role >= 0 ? data(index(idx, 0), role) : QVariant();
 }
 
 void SortFilterProxyModel::classBegin()
@@ -128,22 +192,37 @@ void SortFilterProxyModel::classBegin()
 void SortFilterProxyModel::componentComplete()
 {
     m_complete = true;
-    if (!m_sortRole.isEmpty())
+    if (!m_sortRole.isEmpty()) {
+        updateSortRoleId();
+        resetSortKeys();
         QSortFilterProxyModel::setSortRole(roleKey(m_sortRole));
+    }
     if (!m_filterRole.isEmpty())
         QSortFilterProxyModel::setFilterRole(roleKey(m_filterRole));
 }
 
 int SortFilterProxyModel::roleKey(const QByteArray &role) const
 {
-    QHash<int, QByteArray> roles = roleNames();
-    QHashIterator<int, QByteArray> it(roles);
-    while (it.hasNext()) {
-        it.next();
-        if (it.value() == role)
-            return it.key();
-    }
-    return -1;
+    return m_roleIds.value(role, -1);
+}
+
+void SortFilterProxyModel::updateRoleIds(const QAbstractItemModel *model)
+{
+    m_roleIds.clear();
+    m_planDirty = true;
+    if (!model)
+        return;
+
+    const QHash<int, QByteArray> roles = model->roleNames();
+    for (auto it = roles.cbegin(); it != roles.cend(); ++it)
+        m_roleIds.insert(it.value(), it.key());
+    updateSortRoleId();
+}
+
+void SortFilterProxyModel::updateSortRoleId()
+{
+    // the base proxy sorts by display role until the named role is set on it
+    m_sortRoleId = m_complete && !m_sortRole.isEmpty() ? roleKey(m_sortRole) : int(Qt::DisplayRole);
 }
 
 QHash<int, QByteArray> SortFilterProxyModel::roleNames() const
@@ -155,25 +234,274 @@ QHash<int, QByteArray> SortFilterProxyModel::roleNames() const
 
 bool SortFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
-    QRegExp rx = filterRegExp();
-    if (rx.isEmpty())
+    const FilterPlan &plan = filterPlan();
+    if (plan.matcher == FilterPlan::Matcher::All)
+        return true;
+
+    QModelIndex sourceIndex = sourceModel()->index(sourceRow, 0, sourceParent);
+    if (!sourceIndex.isValid())
         return true;
+    if (sourceParent.isValid())
+        return acceptsRow(plan, sourceIndex);
+
+    if (m_accepted.empty())
+        m_accepted.assign(sourceModel()->rowCount(), kAcceptUnknown);
+    if (sourceRow >= static_cast<int>(m_accepted.size()))
+        return acceptsRow(plan, sourceIndex);
+
+    int8_t &accepted = m_accepted[sourceRow];
+    if (accepted == kAcceptUnknown)
+        accepted = acceptsRow(plan, sourceIndex) ? 1 : 0;
+    return accepted;
+}
+
+SortFilterProxyModel::FilterPlan SortFilterProxyModel::compileFilter(const QString &filter, FilterSyntax syntax) const
+{
+    FilterPlan plan;
+    plan.caseSensitivity = filterCaseSensitivity();
+    if (filter.isEmpty())
+        return plan;
+
+    // no filter role means any role
+    if (!m_filterRole.isEmpty())
+        plan.roles.push_back(roleKey(m_filterRole));
+    else
+        plan.roles = m_roleIds.values().toVector();
+
+    static const QString wildcardChars = QStringLiteral("*?[");
+    static const QString regExpChars = QStringLiteral("\\^$.|?*+()[]{}");
+    const QString &special = syntax == Wildcard ? wildcardChars : regExpChars;
+    const bool plain = syntax == FixedString
+        || std::none_of(filter.begin(), filter.end(), [&special](QChar c) { return special.contains(c); });
+
+    if (plain) {
+        plan.matcher = FilterPlan::Matcher::Substring;
+        plan.substring = filter;
+    } else {
+        plan.matcher = FilterPlan::Matcher::Pattern;
+        plan.pattern = QRegExp(filter, plan.caseSensitivity, static_cast<QRegExp::PatternSyntax>(syntax));
+    }
+    return plan;
+}
+
+const SortFilterProxyModel::FilterPlan &SortFilterProxyModel::filterPlan() const
+{
+    // case sensitivity is set on the base proxy directly, so it is checked here
+    if (m_planDirty || m_plan.caseSensitivity != filterCaseSensitivity()) {
+        m_plan = compileFilter(filterString(), filterSyntax());
+        m_planDirty = false;
+        m_accepted.clear();
+    }
+    return m_plan;
+}
+
+bool SortFilterProxyModel::acceptsRow(const FilterPlan &plan, const QModelIndex &sourceIndex) const
+{
+    const QAbstractItemModel *model = sourceModel();
+    for (int role : plan.roles) {
+        if (matches(plan, plan.pattern, model->data(sourceIndex, role).toString()))
+            return true;
+    }
+    return false;
+}
+
+bool SortFilterProxyModel::matches(const FilterPlan &plan, const QRegExp &pattern, const QString &value)
+{
+    switch (plan.matcher) {
+    case FilterPlan::Matcher::Substring:
+        return value.contains(plan.substring, plan.caseSensitivity);
+    case FilterPlan::Matcher::Pattern:
+        return value.contains(pattern);
+    default:
+        return true;
+    }
+}
+
+void SortFilterProxyModel::prepareFilter(const QString &filter, FilterSyntax syntax)
+{
+    m_planDirty = true;
+    m_accepted.clear();
+
     QAbstractItemModel *model = sourceModel();
-    if (filterRole().isEmpty()) {
-        QHash<int, QByteArray> roles = roleNames();
-        QHashIterator<int, QByteArray> it(roles);
-        while (it.hasNext()) {
-            it.next();
-            QModelIndex sourceIndex = model->index(sourceRow, 0, sourceParent);
-            QString key = model->data(sourceIndex, it.key()).toString();
-            if (key.contains(rx))
-                return true;
+    if (!m_complete || !model)
+        return;
+
+    const int rows = model->rowCount();
+    if (rows < kParallelFilterRows)
+        return;
+
+    FilterPlan plan = compileFilter(filter, syntax);
+    if (plan.matcher == FilterPlan::Matcher::All || plan.roles.size() != 1)
+        return;
+
+    // values are read here, the source is not thread safe, only the matching runs on the pool
+    std::vector<QString> values(rows);
+    for (int row = 0; row < rows; ++row)
+        values[row] = model->data(model->index(row, 0), plan.roles.front()).toString();
+
+    std::vector<int8_t> accepted(rows, 0);
+    // QRegExp is only reentrant, each chunk gets its own copy made here on the calling thread
+    auto matchRange = [&plan, &values, &accepted](const QRegExp &pattern, int first, int last) {
+        for (int row = first; row < last; ++row)
+            accepted[row] = matches(plan, pattern, values[row]);
+    };
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int chunks = std::max(1, pool->maxThreadCount());
+    const int chunkSize = (rows + chunks - 1) / chunks;
+
+    QSemaphore done;
+    int started = 0;
+    for (int first = chunkSize; first < rows; first += chunkSize, ++started) {
+        const int last = std::min(rows, first + chunkSize);
+        QRegExp pattern = plan.pattern;
+        pool->start(new FilterChunk([&matchRange, pattern = std::move(pattern), first, last] { matchRange(pattern, first, last); }, done));
+    }
+    matchRange(plan.pattern, 0, std::min(rows, chunkSize));
+    done.acquire(started);
+
+    m_accepted = std::move(accepted);
+    m_plan = std::move(plan);
+    m_planDirty = false;
+}
+
+void SortFilterProxyModel::onSourceReset()
+{
+    updateRoleIds(sourceModel());
+    m_accepted.clear();
+    resetSortKeys();
+}
+
+bool SortFilterProxyModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
+{
+    const QVariant l = sortKey(left);
+    const QVariant r = sortKey(right);
+
+    // sort roles are numbers mostly, compare them natively
+    switch (l.userType()) {
+    case QMetaType::Int:
+    case QMetaType::LongLong:
+        if (r.userType() == l.userType())
+            return l.toLongLong() < r.toLongLong();
+        break;
+    case QMetaType::UInt:
+    case QMetaType::ULongLong:
+        if (r.userType() == l.userType())
+            return l.toULongLong() < r.toULongLong();
+        break;
+    case QMetaType::Double:
+        if (r.userType() == QMetaType::Double)
+            return l.toDouble() < r.toDouble();
+        break;
+    case QMetaType::Bool:
+        if (r.userType() == QMetaType::Bool)
+            return l.toBool() < r.toBool();
+        break;
+    case QMetaType::QString:
+        if (r.userType() == QMetaType::QString) {
+            return isSortLocaleAware()
+                ? QString::localeAwareCompare(l.toString(), r.toString()) < 0
+                : QString::compare(l.toString(), r.toString(), sortCaseSensitivity()) < 0;
         }
-        return false;
+        break;
+    case QMetaType::QDateTime:
+        if (r.userType() == QMetaType::QDateTime)
+            return l.toDateTime() < r.toDateTime();
+        break;
+    default:
+        break;
     }
-    QModelIndex sourceIndex = model->index(sourceRow, 0, sourceParent);
-    if (!sourceIndex.isValid())
-        return true;
-    QString key = model->data(sourceIndex, roleKey(filterRole())).toString();
-    return key.contains(rx);
+    return QSortFilterProxyModel::lessThan(left, right);
+}
+
+QVariant SortFilterProxyModel::sortKey(const QModelIndex &index) const
+{
+    const size_t row = static_cast<size_t>(index.row());
+    if (index.parent().isValid() || row >= m_sortKeys.size())
+        return sourceModel()->data(index, m_sortRoleId);
+
+    if (!m_sortKeyValid[row]) {
+        m_sortKeys[row] = sourceModel()->data(index, m_sortRoleId);
+        m_sortKeyValid[row] = true;
+    }
+    return m_sortKeys[row];
+}
+
+void SortFilterProxyModel::resetSortKeys()
+{
+    const int rows = sourceModel() ? sourceModel()->rowCount() : 0;
+    m_sortKeys.assign(rows, QVariant());
+    m_sortKeyValid.assign(rows, false);
+}
+
+void SortFilterProxyModel::onSourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid())
+        return;
+    if (!m_accepted.empty() && first <= static_cast<int>(m_accepted.size()))
+        m_accepted.insert(m_accepted.begin() + first, last - first + 1, kAcceptUnknown);
+    else
+        m_accepted.clear();
+    if (first > static_cast<int>(m_sortKeys.size()))
+        return;
+    m_sortKeys.insert(m_sortKeys.begin() + first, last - first + 1, QVariant());
+    m_sortKeyValid.insert(m_sortKeyValid.begin() + first, last - first + 1, false);
+}
+
+void SortFilterProxyModel::onSourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid())
+        return;
+    if (last < static_cast<int>(m_accepted.size()))
+        m_accepted.erase(m_accepted.begin() + first, m_accepted.begin() + last + 1);
+    else
+        m_accepted.clear();
+    if (last >= static_cast<int>(m_sortKeys.size()))
+        return;
+    m_sortKeys.erase(m_sortKeys.begin() + first, m_sortKeys.begin() + last + 1);
+    m_sortKeyValid.erase(m_sortKeyValid.begin() + first, m_sortKeyValid.begin() + last + 1);
+}
+
+void SortFilterProxyModel::onSourceRowsMoved(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row)
+{
+    if (parent.isValid() || destination.isValid()) {
+        m_accepted.clear();
+        resetSortKeys();
+        return;
+    }
+
+    const int rows = sourceModel()->rowCount();
+    if (static_cast<int>(m_accepted.size()) == rows)
+        moveRange(m_accepted, start, end, row);
+    else
+        m_accepted.clear();
+
+    if (static_cast<int>(m_sortKeys.size()) == rows) {
+        moveRange(m_sortKeys, start, end, row);
+        moveRange(m_sortKeyValid, start, end, row);
+    } else {
+        resetSortKeys();
+    }
+}
+
+void SortFilterProxyModel::onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (topLeft.parent().isValid())
+        return;
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+
+    const QVector<int> &filterRoles = filterPlan().roles;
+    const bool filterChanged = roles.isEmpty()
+        || std::any_of(roles.begin(), roles.end(), [&filterRoles](int role) { return filterRoles.contains(role); });
+    if (filterChanged) {
+        for (int row = first; row <= last && row < static_cast<int>(m_accepted.size()); ++row)
+            m_accepted[row] = kAcceptUnknown;
+    }
+
+    if (!roles.isEmpty() && !roles.contains(m_sortRoleId))
+        return;
+    for (int row = first; row <= last && row < static_cast<int>(m_sortKeyValid.size()); ++row)
+        m_sortKeyValid[row] = false;
 }
@@ -15,6 +15,9 @@
 
 #include <QtCore/qsortfilterproxymodel.h>
 #include <QtQml/qqmlparserstatus.h>
+#include <QRegExp>
+#include <cstdint>
+#include <vector>
 
 class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStatus
 {
@@ -59,6 +62,8 @@ public:
     FilterSyntax filterSyntax() const;
     void setFilterSyntax(FilterSyntax syntax);
 
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
     int count() const;
     Q_INVOKABLE QVariantMap get(int index) const;
     Q_INVOKABLE QVariant getRoleValue(int index, QByteArray roleName) const;
@@ -73,9 +78,62 @@ protected:
     int roleKey(const QByteArray &role) const;
     QHash<int, QByteArray> roleNames() const;
     bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
+    bool lessThan(const QModelIndex &left, const QModelIndex &right) const override;
 
 private:
+    //
+    // Filter compiled once per filter change: role ids are resolved and the matcher is picked,
+    // patterns without wildcards or regexp syntax are matched as plain substrings
+    //
+    struct FilterPlan
+    {
+        enum class Matcher
+        {
+            All,
+            Substring,
+            Pattern
+        };
+
+        Matcher matcher = Matcher::All;
+        QVector<int> roles;
+        QString substring;
+        QRegExp pattern;
+        Qt::CaseSensitivity caseSensitivity = Qt::CaseSensitive;
+    };
+
+    FilterPlan compileFilter(const QString &filter, FilterSyntax syntax) const;
+    const FilterPlan &filterPlan() const;
+    bool acceptsRow(const FilterPlan &plan, const QModelIndex &sourceIndex) const;
+    static bool matches(const FilterPlan &plan, const QRegExp &pattern, const QString &value);
+    void prepareFilter(const QString &filter, FilterSyntax syntax);
+    void updateRoleIds(const QAbstractItemModel *model);
+    void updateSortRoleId();
+    void onSourceReset();
+
+    // Sort keys of the source rows, read once per row instead of twice per comparison.
+    // Kept aligned with the source rows, connected before the base proxy handlers
+    QVariant sortKey(const QModelIndex &index) const;
+    void resetSortKeys();
+    void onSourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void onSourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void onSourceRowsMoved(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row);
+    void onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+
+    mutable std::vector<QVariant> m_sortKeys;
+    mutable std::vector<bool> m_sortKeyValid;
+
+    QHash<QByteArray, int> m_roleIds;
+    mutable FilterPlan m_plan;
+    mutable bool m_planDirty = true;
+
+    // accepted flags of the source rows, kept aligned with them like the sort keys.
+    // Filled in parallel for large sources when the filter changes, row by row otherwise,
+    // changed rows are matched again only when a filter role changed
+    enum : int8_t { kAcceptUnknown = -1 };
+    mutable std::vector<int8_t> m_accepted;
+
     bool m_complete;
     QByteArray m_sortRole;
+    int m_sortRoleId = Qt::DisplayRole;
     QByteArray m_filterRole;
 };
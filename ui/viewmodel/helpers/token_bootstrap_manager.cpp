@@ -20,47 +20,18 @@
 
 TokenBootstrapManager::TokenBootstrapManager()
     : _wallet_model(AppModel::getInstance().getWalletModel())
+    , _transactions(AppModel::getInstance().getTransactions())
 {
-    connect(
-        _wallet_model.get(),
-        SIGNAL(transactionsChanged(beam::wallet::ChangeAction,
-                        const std::vector<beam::wallet::TxDescription>&)),
-        SLOT(onTransactionsChanged(beam::wallet::ChangeAction,
-                        const std::vector<beam::wallet::TxDescription>&)));
-    _wallet_model->getAsync()->getTransactions();
+    connect(_transactions.get(), &TransactionsStore::transactionsChanged, this, &TokenBootstrapManager::onTransactionsChanged);
+    _transactions->load();
 }
 
 TokenBootstrapManager::~TokenBootstrapManager() {}
 
 void TokenBootstrapManager::onTransactionsChanged(
-    beam::wallet::ChangeAction action,
-    const std::vector<beam::wallet::TxDescription>& items)
+    beam::wallet::ChangeAction,
+    const std::vector<beam::wallet::TxDescription>&)
 {
-    switch (action)
-    {
-    case beam::wallet::ChangeAction::Reset:
-        _myTxIds.clear(); // no break
-    case beam::wallet::ChangeAction::Added:
-    case beam::wallet::ChangeAction::Updated:
-        for (const auto& item : items)
-        {
-            if (const auto& id = item.GetTxID(); id)
-            {
-                _myTxIds.insert(*id);
-            }
-        }
-        break;
-    case beam::wallet::ChangeAction::Removed:
-        for (const auto& item : items)
-        {
-            if (const auto& id = item.GetTxID(); id)
-            {
-                _myTxIds.erase(*id);
-            }
-        }
-        break;
-    }
-
     checkIsTxPreviousAccepted();
 }
 
@@ -91,22 +62,25 @@ void TokenBootstrapManager::checkTokenForDuplicate(const QString& token)
     auto txIdValue = txId.value();
     _tokensInProgress[txIdValue] = token;
 
-    _myTxIds.empty()
-        ? _wallet_model->getAsync()->getTransactions()
-        : checkIsTxPreviousAccepted();
+    _transactions->isLoaded()
+        ? checkIsTxPreviousAccepted()
+        : _transactions->load();
 }
 
 void TokenBootstrapManager::checkIsTxPreviousAccepted()
 {
     if (!_tokensInProgress.empty())
     {
-        for (const auto& txId : _myTxIds)
+        for (auto it = _tokensInProgress.begin(); it != _tokensInProgress.end();)
         {
-            const auto& it = _tokensInProgress.find(txId);
-            if (it != _tokensInProgress.end())
+            if (_transactions->contains(it->first))
             {
                 emit tokenPreviousAccepted(it->second);
-                _tokensInProgress.erase(it);
+                it = _tokensInProgress.erase(it);
+            }
+            else
+            {
+                ++it;
             }
         }
 
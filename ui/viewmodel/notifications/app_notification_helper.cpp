@@ -26,8 +26,8 @@ AppNotificationHelper::AppNotificationHelper()
     m_estimateBlockTime = timeFromLastBlock > averageBlockTime ? 1 : averageBlockTime - timeFromLastBlock;
 
     connect(
-        walletPtr,
-        &WalletModel::transactionsChanged,
+        AppModel::getInstance().getTransactions().get(),
+        &TransactionsStore::transactionsChanged,
         this,
         &AppNotificationHelper::onTransactionsChanged);
 }
@@ -23,7 +23,7 @@ using namespace beam;
 namespace {
     QString getAmount(const beam::wallet::TxParameters &p)
     {
-        return beamui::AmountToUIString(*p.GetParameter<Amount>(beam::wallet::TxParameterID::Amount));
+        return beamui::AmountToLocaleString(*p.GetParameter<Amount>(beam::wallet::TxParameterID::Amount));
     }
 
     QString getSwapAmount(const beam::wallet::TxParameters &p)
@@ -32,7 +32,7 @@ namespace {
 
         auto amount = *p.GetParameter<Amount>(TxParameterID::AtomicSwapAmount);
         auto swapCoin = *p.GetParameter<AtomicSwapCoin>(TxParameterID::AtomicSwapCoin);
-        return beamui::AmountToUIString(amount, beamui::convertSwapCoinToCurrency(swapCoin));
+        return beamui::AmountToLocaleString(amount, beamui::convertSwapCoinToCurrency(swapCoin));
     }
 
     bool isBeamSide(const beam::wallet::TxParameters &p)
@@ -16,9 +16,13 @@
 #include "model/app_model.h"
 
 NotificationsList::NotificationsList()
+    : m_assetRows(*this, [](const std::shared_ptr<NotificationItem>& item, std::vector<beam::Asset::ID>& ids)
+    {
+        ids.push_back(item->assetId());
+    })
 {
     _amgr = AppModel::getInstance().getAssets();
-    connect(_amgr.get(), &AssetsManager::assetInfo, this, &NotificationsList::onAssetInfo);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged, this, &NotificationsList::onAssetsInfo);
 }
 
 QHash<int, QByteArray> NotificationsList::roleNames() const
@@ -87,12 +91,18 @@ QVariant NotificationsList::data(const QModelIndex &index, int role) const
     }
 }
 
-void NotificationsList::onAssetInfo(beam::Asset::ID assetId)
+ECC::uintBig NotificationsList::getKey(const std::shared_ptr<NotificationItem>& item) const
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->assetId() == assetId) {
-           const auto idx = it - m_list.begin();
-           ListModel::touch(idx);
-        }
-    }
+    return item->getID();
+}
+
+bool NotificationsList::hasChanged(const std::shared_ptr<NotificationItem>& prev, const std::shared_ptr<NotificationItem>& next) const
+{
+    return prev->getState() != next->getState()
+        || prev->getTimestamp() != next->getTimestamp();
+}
+
+void NotificationsList::onAssetsInfo(const QSet<beam::Asset::ID>& assets)
+{
+    emitDataChanged(m_assetRows.getRows(assets), { static_cast<int>(Roles::Message) });
 }
@@ -16,10 +16,11 @@
 
 #include "notification_item.h"
 #include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/asset_row_index.h"
 #include "model/assets_manager.h"
 #include <QLocale>
 
-class NotificationsList : public ListModel<std::shared_ptr<NotificationItem>>
+class NotificationsList : public ListModel<std::shared_ptr<NotificationItem>, ECC::uintBig>
 {
     Q_OBJECT
 
@@ -43,9 +44,14 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+protected:
+    ECC::uintBig getKey(const std::shared_ptr<NotificationItem>& item) const override;
+    bool hasChanged(const std::shared_ptr<NotificationItem>& prev, const std::shared_ptr<NotificationItem>& next) const override;
+
 private:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const QSet<beam::Asset::ID>& assets);
 
     QLocale m_locale; // default locale
     AssetsManager::Ptr _amgr;
+    AssetRowIndex<std::shared_ptr<NotificationItem>, ECC::uintBig> m_assetRows;
 };
@@ -19,14 +19,13 @@
 
 PushNotificationManager::PushNotificationManager()
     : m_walletModel(AppModel::getInstance().getWalletModel())
+    , m_transactions(AppModel::getInstance().getTransactions())
 {
     connect(m_walletModel.get(),
             SIGNAL(notificationsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::Notification>&)),
             SLOT(onNotificationsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::Notification>&)));
 
-    connect(m_walletModel.get(),
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
+    connect(m_transactions.get(), &TransactionsStore::contractNotificationsAdded, this, &PushNotificationManager::onContractNotificationsAdded);
 
     m_walletModel->getAsync()->getNotifications();
 }
@@ -76,36 +75,21 @@ void PushNotificationManager::onNotificationsChanged(beam::wallet::ChangeAction
     }
 }
 
-void PushNotificationManager::onTransactionsChanged(
-    beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
+void PushNotificationManager::onContractNotificationsAdded(const std::vector<beam::wallet::TxID>& txIds)
 {
-    using namespace beam::wallet;
-
-    for (const auto& modifiedTx : transactions)
+    // the store keeps which contract transactions are notified, a popup is shown once per entry
+    for (const auto& txId : txIds)
     {
-        if(const auto txType = modifiedTx.GetParameter<TxType>(TxParameterID::TransactionType); *txType != TxType::Contract)
+        const auto* tx = m_transactions->getTransaction(txId);
+        if (!tx || !m_transactions->hasContractNotification(txId))
         {
             continue;
         }
 
-        auto modifiedTxObj = TxObject(modifiedTx);
-        if (modifiedTxObj.canShowContractNotification())
-        {
-            const auto txId = modifiedTxObj.getTxID();
-            if (m_contractNotifications.find(txId) == m_contractNotifications.end())
-            {
-                m_contractNotifications.insert(txId);
-                const auto txIdStr = std::to_string(txId);
-                // TODO add mechanism to get app icon
-                emit showContractNotification(
-                    txIdStr.c_str(), modifiedTxObj.getSource(), modifiedTxObj.getComment(), "");
-            }
-        }
-        else
-        {
-            if (m_contractNotifications.empty()) continue;
-            m_contractNotifications.erase(modifiedTxObj.getTxID());
-        }
+        TxObject txObj(*tx);
+        const auto txIdStr = std::to_string(txId);
+        // TODO add mechanism to get app icon
+        emit showContractNotification(txIdStr.c_str(), txObj.getSource(), txObj.getComment(), "");
     }
 }
 
@@ -117,13 +101,15 @@ void PushNotificationManager::onCancelPopup(const QVariant& variantID)
 
 void PushNotificationManager::closeContractNotification(const QString& txIdStr)
 {
-    if (m_contractNotifications.empty()) return;
-
     beam::wallet::TxID txId;
     auto txIdVec = beam::from_hex(txIdStr.toStdString());
     std::copy_n(txIdVec.begin(), 16, txId.begin());
-    m_walletModel->getAsync()->markAppNotificationAsRead(txId);
-    m_contractNotifications.erase(txId);
+
+    // the store drops the entry when the transaction comes back marked as read
+    if (m_transactions->hasContractNotification(txId))
+    {
+        m_walletModel->getAsync()->markAppNotificationAsRead(txId);
+    }
 }
 
 bool PushNotificationManager::hasNewerVersion() const
@@ -42,12 +42,11 @@ public slots:
     void onNewSoftwareUpdateAvailable(
         const beam::wallet::WalletImplVerInfo&, const ECC::uintBig& notificationID, bool showPopup);
     void onNotificationsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::Notification>&);
-    void onTransactionsChanged(
-        beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+    void onContractNotificationsAdded(const std::vector<beam::wallet::TxID>& txIds);
 
 private:
     WalletModel::Ptr m_walletModel;
+    TransactionsStore::Ptr m_transactions;
     bool m_firstNotification = true;
     bool m_hasNewerVersion = false;
-    std::set<beam::wallet::TxID> m_contractNotifications;
 };
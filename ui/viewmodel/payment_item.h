@@ -46,7 +46,7 @@ signals:
     void paymentProofChanged();
 
 private:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const QSet<beam::Asset::ID>& assets);
 
     QString m_paymentProof;
     boost::optional<beam::wallet::storage::PaymentInfo> m_paymentInfo;
@@ -21,16 +21,13 @@
 #include "ui_helpers.h"
 #include "wallet/client/extensions/offers_board/swap_offer_token.h"
 #include "wallet/transactions/swaps/utils.h"
-#include "utility/string_helpers.h"
 
-#include <boost/algorithm/string.hpp>
-#include <boost/multiprecision/cpp_dec_float.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include "3rdparty/libbitcoin/include/bitcoin/bitcoin/formats/base_10.hpp"
 
 #include "fee_helpers.h"
+#include "viewmodel/helpers/fixed_amount.h"
 
-using boost::multiprecision::cpp_dec_float_50;
 using boost::multiprecision::cpp_int;
 
 namespace
@@ -38,12 +35,6 @@ namespace
     constexpr uint8_t kBTCDecimalPlaces = libbitcoin::btc_decimal_places;
     constexpr uint8_t kUSDDecimalPlaces = 2;
 
-    template <char C>
-    bool char_is(const char c)
-    {
-        return c == C;
-    }
-
     beamui::Currencies convertUiCurrencyToCurrencies(OldWalletCurrency::OldCurrency currency)
     {
         switch (currency)
@@ -230,17 +221,11 @@ QString QMLGlobals::roundUp(QString amount)
     }
     else
     {
-        const auto targetDecimals = amount.length() - point - 2;
-        const cpp_dec_float_50 scale = pow(cpp_dec_float_50(10), targetDecimals);
-
-        const cpp_dec_float_50 original(amount.toStdString().c_str());
-        const cpp_dec_float_50 rounded = ceil(original * scale) / scale;
-
-        auto roundedStr = rounded.str(targetDecimals, std::ios_base::fixed);
-        boost::algorithm::trim_right_if(roundedStr, char_is<'0'>);
-        boost::algorithm::trim_right_if(roundedStr, char_is<'.'>);
+        const auto targetDecimals = static_cast<uint8_t>(amount.length() - point - 2);
+        const auto original = FixedAmount::fromString(amount.toStdString());
+        const auto rounded = original ? original->rescale(targetDecimals, FixedAmount::Rounding::Up) : std::nullopt;
 
-        return QString(roundedStr.c_str());
+        return rounded ? QString::fromStdString(rounded->toString()) : amount;
     }
 }
 
@@ -423,63 +408,37 @@ QString QMLGlobals::getDefaultFee(OldWalletCurrency::OldCurrency currency)
 
 QString QMLGlobals::divideWithPrecision(const QString& dividend, const QString& divider, uint precision)
 {
-    cpp_dec_float_50 dec_dividend(dividend.toStdString().c_str());
-    cpp_dec_float_50 dec_divider(divider.toStdString().c_str());
-
-    cpp_dec_float_50 quotient = dec_dividend / dec_divider;
-
-    std::ostringstream oss;
-    oss.precision(std::numeric_limits<cpp_dec_float_50>::digits10);
-    oss << std::fixed << quotient;
+    const auto first = FixedAmount::fromString(dividend.toStdString());
+    const auto second = FixedAmount::fromString(divider.toStdString());
+    if (!first || !second)
+    {
+        return "";
+    }
 
-    QString result = QString::fromStdString(oss.str());
-    return roundWithPrecision(result, precision);
+    // empty on zero divider or overflow
+    const auto quotient = first->divide(*second, static_cast<uint8_t>(precision), FixedAmount::Rounding::HalfUp);
+    return quotient ? QString::fromStdString(quotient->toString()) : "";
 }
 
 QString QMLGlobals::multiplyWithPrecision(const QString& first, const QString& second, uint precision)
 {
-    cpp_dec_float_50 dec_first(first.toStdString().c_str());
-    cpp_dec_float_50 dec_second(second.toStdString().c_str());
-
-    cpp_dec_float_50 product = dec_first * dec_second;
-
-    std::ostringstream oss;
-    oss.precision(std::numeric_limits<cpp_dec_float_50>::digits10);
-    oss << std::fixed << product;
+    const auto a = FixedAmount::fromString(first.toStdString());
+    const auto b = FixedAmount::fromString(second.toStdString());
+    if (!a || !b)
+    {
+        return "";
+    }
 
-    QString result = QString::fromStdString(oss.str());
-    return roundWithPrecision(result, precision);
+    const auto product = a->multiply(*b, static_cast<uint8_t>(precision), FixedAmount::Rounding::HalfUp);
+    return product ? QString::fromStdString(product->toString()) : "";
 }
 
 QString QMLGlobals::roundWithPrecision(const QString& number, uint precision)
 {
-    //TODO rounding precision
-    const char delimeter = '.';
-    auto parts = string_helpers::split(number.toStdString(), delimeter);
-
-    std::string result;
-    std::ostringstream oss;
-    if (parts.size() == 2)
-    {    
-        cpp_dec_float_50 afterPoint("0." + parts[1]);
-
-        std::ostringstream afterPointOss;
-        afterPointOss.precision(static_cast<uint8_t>(precision));
-        afterPointOss << std::fixed << afterPoint;
-
-        auto afterPointParts = string_helpers::split(afterPointOss.str(), delimeter);
-        oss << parts[0] << delimeter << (afterPointParts.size() > 1 ? afterPointParts[1] : "0");
-        result = oss.str();
-        boost::algorithm::trim_right_if(result, char_is<'0'>);
-        boost::algorithm::trim_right_if(result, char_is<'.'>);
-    }
-    else
-    {
-        oss << parts[0];
-        result = oss.str();
-    }
-
-    return QString::fromStdString(result);
+    // not a number is shown as is
+    const auto value = FixedAmount::fromString(number.toStdString());
+    const auto rounded = value ? value->rescale(static_cast<uint8_t>(precision), FixedAmount::Rounding::HalfUp) : std::nullopt;
+    return rounded ? QString::fromStdString(rounded->toString()) : number;
 }
 
 QString QMLGlobals::rawTxIdToStr(const QVariant& txId)
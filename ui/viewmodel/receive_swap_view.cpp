@@ -17,7 +17,6 @@
 #include "model/app_model.h"
 #include "wallet/transactions/swaps/utils.h"
 #include <QClipboard>
-#include "qml_globals.h"
 #include "fee_helpers.h"
 #include "wallet/transactions/swaps/bridges/ethereum/ethereum_side.h"
 #include "atomic_swap/swap_utils.h"
@@ -138,10 +137,7 @@ QString ReceiveSwapViewModel::getRate() const
     beamui::Currencies otherCurrency =
         convertCurrency(isSendBeam() ? _receiveCurrency : _sentCurrency);
 
-    return QMLGlobals::divideWithPrecision(
-        beamui::AmountToUIString(otherCoinAmount, otherCurrency, false), 
-        beamui::AmountToUIString(beamAmount),
-        beamui::getCurrencyDecimals(otherCurrency));
+    return beamui::SwapRateToUIString(otherCoinAmount, otherCurrency, beamAmount);
 }
 
 void ReceiveSwapViewModel::onSwapParamsLoaded(const beam::ByteBuffer& params)
@@ -484,10 +484,7 @@ QString SendSwapViewModel::getRate() const
     beamui::Currencies otherCurrency =
         convertCurrency(isSendBeam() ? _receiveCurrency : _sendCurrency);
 
-    return QMLGlobals::divideWithPrecision(
-        beamui::AmountToUIString(otherCoinAmount, otherCurrency, false),
-        beamui::AmountToUIString(beamAmount),
-        beamui::getCurrencyDecimals(otherCurrency));
+    return beamui::SwapRateToUIString(otherCoinAmount, otherCurrency, beamAmount);
 }
 
 QString SendSwapViewModel::getSecondCurrencySendRateValue() const
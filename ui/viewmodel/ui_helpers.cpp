@@ -4,6 +4,8 @@
 #include <QTextStream>
 #include "3rdparty/libbitcoin/include/bitcoin/bitcoin/formats/base_10.hpp"
 #include "version.h"
+#include "viewmodel/helpers/fixed_amount.h"
+#include "viewmodel/helpers/amount_formatter.h"
 #include "core/common.h"
 
 #include "wallet/transactions/swaps/bridges/ethereum/common.h"
@@ -126,8 +128,30 @@ namespace beamui
 
     QString AmountToUIString(const Amount& value, const QString& unitName, uint8_t decimalPlaces)
     {
-        const auto samount = libbitcoin::encode_base10(value, decimalPlaces ? decimalPlaces : beamDecimals());
-        return QString::fromStdString(samount) + (unitName.isEmpty() ? "" : " " + unitName);
+        auto samount = AmountFormatter::toUIString(value, decimalPlaces ? decimalPlaces : beamDecimals());
+        if (!unitName.isEmpty())
+        {
+            samount.reserve(samount.size() + unitName.size() + 1);
+            samount += QChar(' ');
+            samount += unitName;
+        }
+        return samount;
+    }
+
+    std::string AmountToUIStdString(const Amount& value, Currencies coinType)
+    {
+        return AmountFormatter::toUIStdString(value, getCurrencyDecimals(coinType));
+    }
+
+    QString AmountToLocaleString(const Amount& value, Currencies coinType, bool currencyLabel)
+    {
+        auto samount = AmountFormatter::toLocaleString(value, getCurrencyDecimals(coinType));
+        if (currencyLabel && coinType != Currencies::Unknown)
+        {
+            samount += QChar(' ');
+            samount += getCurrencyUnitName(coinType);
+        }
+        return samount;
     }
 
      QString AmountBigToUIString(const beam::AmountBig::Type& value)
@@ -162,10 +186,23 @@ namespace beamui
     beam::Amount UIStringToAmount(const QString& value, Currencies currency)
     {
         beam::Amount amount = 0;
-        libbitcoin::decode_base10(amount, value.toStdString(), getCurrencyDecimals(currency), true);
+        if (!AmountFormatter::fromUIString(value, getCurrencyDecimals(currency), amount))
+        {
+            return 0;
+        }
         return amount;
     }
 
+    QString SwapRateToUIString(const beam::Amount& coinAmount, Currencies coinType, const beam::Amount& beamAmount)
+    {
+        const auto decimals = getCurrencyDecimals(coinType);
+        const FixedAmount coinValue(coinAmount, decimals);
+        const FixedAmount beamValue(beamAmount, getCurrencyDecimals(Currencies::Beam));
+
+        const auto rate = coinValue.divide(beamValue, decimals, FixedAmount::Rounding::HalfUp);
+        return rate ? QString::fromStdString(rate->toString()) : QString();
+    }
+
     QString toString(const QDateTime& dt)
     {
         return dt.toString(QLocale().dateTimeFormat(QLocale::ShortFormat));
@@ -75,6 +75,10 @@ namespace beamui
     QString AmountToUIString(const beam::Amount& value, Currencies coinType = Currencies::Unknown, bool currencyLabel = true);
     QString AmountToUIString(const beam::Amount& value, const QString& unitName, uint8_t decimalPlaces = 0);
     QString AmountBigToUIString(const beam::AmountBig::Type& value);
+    /// Same as AmountToUIString as UTF-8, without currency label
+    std::string AmountToUIStdString(const beam::Amount& value, Currencies coinType = Currencies::Unknown);
+    /// Decimal and group separators of the default locale, for amounts shown in plain text
+    QString AmountToLocaleString(const beam::Amount& value, Currencies coinType = Currencies::Unknown, bool currencyLabel = true);
 
     // value -> s"value GROTH"
     QString AmountInGrothToUIString(const beam::Amount& value);
@@ -82,6 +86,9 @@ namespace beamui
     /// expects ui string with a "." as a separator
     beam::Amount UIStringToAmount(const QString& value, Currencies currency = Currencies::Unknown);
 
+    /// Swap coin units per BEAM with the coin decimals, "." as a separator. Empty for zero BEAM amount.
+    QString SwapRateToUIString(const beam::Amount& coinAmount, Currencies coinType, const beam::Amount& beamAmount);
+
     Currencies convertExchangeRateCurrencyToUiCurrency(const beam::wallet::Currency&);
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
     Currencies convertSwapCoinToCurrency(beam::wallet::AtomicSwapCoin coin);
@@ -127,6 +127,19 @@ uint16_t UtxoItem::rawMaturityTimeLeft() const
     return 0;
 }
 
+beam::Height UtxoItem::getRefreshHeight(beam::Height currentHeight) const
+{
+    // time left is shown in whole hours of blocks, it changes once the next hour boundary is crossed
+    const auto maturity = rawMaturity();
+    if (currentHeight >= maturity)
+    {
+        return 0;
+    }
+
+    const Height hoursLeft = (maturity - currentHeight) / 60;
+    return hoursLeft ? maturity - hoursLeft * 60 + 1 : 0;
+}
+
 beam::Asset::ID UtxoItem::getAssetId() const
 {
     return _coin.m_ID.m_AssetID;
@@ -223,6 +236,12 @@ uint16_t ShieldedCoinItem::rawMaturityTimeLeft() const
     return _walletModel->getMaturityHoursLeft(_coin);
 }
 
+beam::Height ShieldedCoinItem::getRefreshHeight(beam::Height currentHeight) const
+{
+    // progress is computed by the wallet, check it every block while the coin matures
+    return rawMaturityTimeLeft() ? currentHeight + 1 : 0;
+}
+
 beam::Asset::ID ShieldedCoinItem::getAssetId() const
 {
     return _coin.m_CoinID.m_AssetID;
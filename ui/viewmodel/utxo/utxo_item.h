@@ -37,6 +37,9 @@ public:
     virtual beam::Amount rawAmount() const = 0;
     virtual beam::Height rawMaturity() const = 0;
     virtual uint16_t rawMaturityTimeLeft() const = 0;
+
+    // First height at which the maturity progress or time left change, 0 if they never do
+    virtual beam::Height getRefreshHeight(beam::Height currentHeight) const = 0;
 };
 
 class UtxoItem : public BaseUtxoItem
@@ -58,6 +61,7 @@ public:
     beam::Amount rawAmount() const override;
     beam::Height rawMaturity() const override;
     uint16_t rawMaturityTimeLeft() const override;
+    beam::Height getRefreshHeight(beam::Height currentHeight) const override;
     const beam::wallet::Coin::ID& get_ID() const;
 private:
     beam::wallet::Coin _coin;
@@ -82,6 +86,7 @@ public:
     beam::Amount rawAmount() const override;
     beam::Height rawMaturity() const override;
     uint16_t rawMaturityTimeLeft() const override;
+    beam::Height getRefreshHeight(beam::Height currentHeight) const override;
 private:
     WalletModel::Ptr _walletModel;
     beam::wallet::ShieldedCoin _coin;
@@ -18,8 +18,17 @@
 
 UtxoItemList::UtxoItemList()
     : _amgr(AppModel::getInstance().getAssets())
+    , m_assetRows(*this, [](const std::shared_ptr<BaseUtxoItem>& item, std::vector<beam::Asset::ID>& ids)
+    {
+        ids.push_back(item->getAssetId());
+    })
+    , m_refreshSchedule(*this, [](const std::shared_ptr<BaseUtxoItem>& item)
+    {
+        return item->getRefreshHeight(AppModel::getInstance().getWalletModel()->getCurrentHeight());
+    })
 {
-    connect(_amgr.get(), &AssetsManager::assetInfo, this,  &UtxoItemList::onAssetInfo);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged, this,  &UtxoItemList::onAssetsInfo);
+    connect(AppModel::getInstance().getWalletModel().get(), &WalletModel::walletStatusChanged, this, &UtxoItemList::onWalletStatus);
 }
 
 QHash<int, QByteArray> UtxoItemList::roleNames() const
@@ -87,17 +96,42 @@ auto UtxoItemList::data(const QModelIndex &index, int role) const -> QVariant
     }
 }
 
-void UtxoItemList::onAssetInfo(beam::Asset::ID assetId)
+uint64_t UtxoItemList::getKey(const std::shared_ptr<BaseUtxoItem>& item) const
+{
+    return item->getHash();
+}
+
+bool UtxoItemList::hasChanged(const std::shared_ptr<BaseUtxoItem>& prev, const std::shared_ptr<BaseUtxoItem>& next) const
+{
+    return prev->status() != next->status()
+        || prev->rawMaturity() != next->rawMaturity()
+        || prev->rawMaturityTimeLeft() != next->rawMaturityTimeLeft();
+}
+
+void UtxoItemList::onAssetsInfo(const QSet<beam::Asset::ID>& assets)
 {
-    touch(assetId);
+    emitDataChanged(m_assetRows.getRows(assets),
+    {
+        static_cast<int>(Roles::UnitName),
+        static_cast<int>(Roles::IconSource),
+        static_cast<int>(Roles::Verified)
+    });
 }
 
-void UtxoItemList::touch(beam::Asset::ID id)
+void UtxoItemList::onWalletStatus()
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getAssetId() == id) {
-           const auto idx = it - m_list.begin();
-           ListModel::touch(idx);
-        }
+    const auto height = AppModel::getInstance().getWalletModel()->getCurrentHeight();
+    if (height == m_height)
+    {
+        return;
     }
+    m_height = height;
+
+    emitDataChanged(m_refreshSchedule.takeDue(height),
+    {
+        static_cast<int>(Roles::MaturityPercentage),
+        static_cast<int>(Roles::MaturityPercentageSort),
+        static_cast<int>(Roles::MaturityTimeLeft),
+        static_cast<int>(Roles::MaturityTimeLeftSort)
+    });
 }
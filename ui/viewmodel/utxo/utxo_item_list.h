@@ -16,9 +16,11 @@
 
 #include "utxo_item.h"
 #include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/asset_row_index.h"
+#include "viewmodel/helpers/refresh_schedule.h"
 #include "model/assets_manager.h"
 
-class UtxoItemList : public ListModel<std::shared_ptr<BaseUtxoItem>>
+class UtxoItemList : public ListModel<std::shared_ptr<BaseUtxoItem>, uint64_t>
 {
     Q_OBJECT
 public:
@@ -46,9 +48,16 @@ public:
     [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
 
 public slots:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const QSet<beam::Asset::ID>& assets);
+    void onWalletStatus();
+
+protected:
+    [[nodiscard]] uint64_t getKey(const std::shared_ptr<BaseUtxoItem>& item) const override;
+    [[nodiscard]] bool hasChanged(const std::shared_ptr<BaseUtxoItem>& prev, const std::shared_ptr<BaseUtxoItem>& next) const override;
 
 private:
-    void touch(beam::Asset::ID id);
     AssetsManager::Ptr _amgr;
+    AssetRowIndex<std::shared_ptr<BaseUtxoItem>, uint64_t> m_assetRows;
+    RefreshSchedule<std::shared_ptr<BaseUtxoItem>, uint64_t> m_refreshSchedule;
+    beam::Height m_height = 0;
 };
@@ -0,0 +1,439 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_details.h"
+#include "viewmodel/ui_helpers.h"
+#include "viewmodel/qml_globals.h"
+#include "model/app_model.h"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace beam;
+using namespace beam::wallet;
+using namespace beamui;
+
+namespace
+{
+    const Height kNormalTxConfirmationDelay = 10;
+
+    QString waitingPeerStateStr(Height minHeight, Height responseTime, bool isSender)
+    {
+        QString time = "";
+        if (minHeight && responseTime)
+        {
+            time = convertBeamHeightDiffToTime(minHeight + responseTime - AppModel::getInstance().getWalletModel()->getCurrentHeight());
+        }
+        if (isSender)
+        {
+            //% "If the receiver doesn't get online in %1, the transaction will be canceled"
+            return qtTrId("tx-state-initial-sender").arg(time);
+        }
+        //% "If the sender doesn't get online in %1, the transaction will be canceled"
+        return qtTrId("tx-state-initial-receiver").arg(time);
+    }
+
+    QString inProgressStateStr(Height maxHeight, Height lifetime)
+    {
+        if (!maxHeight)
+        {
+            return "";
+        }
+
+        auto currentHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
+        if (currentHeight >= maxHeight)
+        {
+            return "";
+        }
+
+        Height delta = maxHeight - currentHeight;
+        if (!lifetime || lifetime < delta)
+        {
+            return "";
+        }
+
+        if (lifetime - delta <= kNormalTxConfirmationDelay)
+        {
+            //% "The transaction is usually expected to complete in a few minutes."
+            return qtTrId("tx-state-in-progress-normal");
+        }
+
+        auto time = convertBeamHeightDiffToTime(delta);
+        if (time.isEmpty())
+        {
+            return "";
+        }
+        //% "It is taking longer than usual. In case the transaction could not be completed it will be canceled automatically in %1."
+        return qtTrId("tx-state-in-progress-long").arg(time);
+    }
+
+    Height waitingPeerStateRefreshHeight(Height minHeight, Height responseTime, Height currentHeight)
+    {
+        // the time left ticks with every block until the peer response time is over
+        if (minHeight && responseTime && currentHeight < minHeight + responseTime)
+        {
+            return currentHeight + 1;
+        }
+        return 0;
+    }
+
+    Height inProgressStateRefreshHeight(Height maxHeight, Height lifetime, Height currentHeight)
+    {
+        if (!maxHeight || !lifetime || currentHeight >= maxHeight)
+        {
+            return 0;
+        }
+
+        // lifetime left: nothing shown yet, then the normal text, then the countdown ticking every block
+        const Height start = maxHeight > lifetime ? maxHeight - lifetime : 0;
+        if (currentHeight < start)
+        {
+            return start;
+        }
+        if (currentHeight - start <= kNormalTxConfirmationDelay)
+        {
+            return start + kNormalTxConfirmationDelay + 1;
+        }
+        return currentHeight + 1;
+    }
+
+    bool isWaitingPeer(TxType type, TxStatus status)
+    {
+        return (type == TxType::Simple && (status == TxStatus::Pending || status == TxStatus::InProgress))
+            || (type == TxType::PushTransaction && status == TxStatus::InProgress);
+    }
+
+    Height getHeight(const TxDescription& tx, TxParameterID id)
+    {
+        Height h = 0;
+        tx.GetParameter(id, h);
+        return h;
+    }
+}
+
+TxContractInfo getTxContractInfo(const TxDescription& tx)
+{
+    TxContractInfo info;
+    const Height h = tx.m_minHeight;
+    info.fee = std::max(tx.m_fee, Transaction::FeeSettings::get(h).get_DefaultStd());
+
+    if (tx.m_txType != TxType::Contract)
+    {
+        return info;
+    }
+
+    bvm2::ContractInvokeData vData;
+    if (tx.GetParameter(TxParameterID::ContractDataPacked, vData))
+    {
+        info.fee = bvm2::getFullFee(vData, h);
+        info.spend = bvm2::getFullSpend(vData);
+    }
+
+    if (!vData.empty())
+    {
+        std::stringstream ss;
+        ss << vData[0].m_Cid.str();
+
+        if (vData.size() > 1)
+        {
+            ss << " +" << vData.size() - 1;
+        }
+
+        info.cids = QString::fromStdString(ss.str());
+    }
+    return info;
+}
+
+std::vector<TxAssetAmount> getTxAssets(const TxDescription& tx, const TxContractInfo& contract, const Currency& secondCurrency)
+{
+    std::vector<TxAssetAmount> assets;
+    auto appendAsset = [&](Asset::ID aid, Amount amount, bool income) {
+        assets.push_back({aid, amount, tx.getExchangeRate(secondCurrency, aid), income});
+    };
+
+    if (tx.m_txType == TxType::Contract)
+    {
+        const bool feeOnly = contract.spend.empty();
+        assets.reserve(contract.spend.size() + (feeOnly ? 1 : 0));
+
+        for (const auto& info: contract.spend)
+        {
+            auto amount = info.second;
+            if (info.first == Asset::s_BeamID)
+            {
+                if (amount < 0)
+                {
+                    amount += contract.fee;
+                }
+            }
+            appendAsset(info.first, std::abs(amount), amount <= 0);
+        }
+
+        if (feeOnly)
+        {
+            appendAsset(Asset::s_BeamID, contract.fee, false);
+        }
+    }
+    else if (tx.m_txType == TxType::DexSimpleSwap)
+    {
+        const auto rasset  = tx.GetParameter<Asset::ID>(TxParameterID::DexReceiveAsset);
+        const auto ramount = tx.GetParameter<Amount>(TxParameterID::DexReceiveAmount);
+        if (!rasset || !ramount)
+        {
+            throw std::runtime_error("No rasset/ramount on DEX tx");
+        }
+
+        appendAsset(*rasset, *ramount, true);
+        appendAsset(tx.m_assetId, tx.m_amount, false);
+    }
+    else
+    {
+        appendAsset(tx.m_assetId, tx.m_amount, !tx.m_sender);
+    }
+    return assets;
+}
+
+Amount getTxAmountGeneral(const TxDescription& tx, const std::vector<TxAssetAmount>& assets)
+{
+    return tx.m_txType == TxType::Contract ? assets.front().amount : tx.m_amount;
+}
+
+Amount getTxFee(const TxDescription& tx, const TxContractInfo& contract)
+{
+    if (tx.m_txType == TxType::Contract)
+    {
+        return contract.fee;
+    }
+
+    if (!tx.m_fee)
+    {
+        return 0;
+    }
+
+    // TODO(zavarza) no fee for shielded inputs after HF3
+    Amount shieldedInputsFee = 0;
+    std::vector<IPrivateKeyKeeper2::ShieldedInput> inputsShielded;
+    if (tx.GetParameter(TxParameterID::InputCoinsShielded, inputsShielded))
+    {
+        for (const auto& inputShielded : inputsShielded)
+        {
+            shieldedInputsFee += inputShielded.m_Fee;
+        }
+    }
+    return shieldedInputsFee + tx.m_fee;
+}
+
+bool isTxIncome(const TxDescription& tx, const TxContractInfo& contract)
+{
+    if (tx.m_txType != TxType::Contract)
+    {
+        return !tx.m_sender;
+    }
+
+    if (isTxFeeOnly(tx, contract))
+    {
+        return false;
+    }
+
+    return std::none_of(contract.spend.begin(), contract.spend.end(), [](const auto& info)
+    {
+        return info.second > 0;
+    });
+}
+
+bool isTxFeeOnly(const TxDescription& tx, const TxContractInfo& contract)
+{
+    return tx.m_txType == TxType::Contract && contract.spend.empty();
+}
+
+QString getTxSource(const TxDescription& tx)
+{
+    if (!tx.m_appName.empty())
+    {
+        return QString::fromStdString(tx.m_appName);
+    }
+    else if (tx.m_txType == TxType::DexSimpleSwap)
+    {
+        //% "Assets Swap"
+        return qtTrId("source-dex");
+    }
+    //% "Wallet"
+    return qtTrId("source-wallet");
+}
+
+QString getTxComment(const TxDescription& tx)
+{
+    std::string str{tx.m_message.begin(), tx.m_message.end()};
+    auto comment = QString(str.c_str()).trimmed();
+
+    if (tx.m_txType == TxType::Contract)
+    {
+        if (comment.isEmpty())
+        {
+            //% "Contract transaction"
+            comment = qtTrId("tx-contract-default-comment");
+        }
+    }
+    else if (tx.m_txType == TxType::DexSimpleSwap)
+    {
+        // TODO:DEX just temporary
+        comment = "DEX transaction";
+    }
+    return comment;
+}
+
+QString getTxAppId(const TxDescription& tx)
+{
+    auto appid = tx.GetParameter<std::string>(TxParameterID::AppID);
+    return appid ? QString::fromStdString(*appid) : QString("");
+}
+
+QString getTxAddressFrom(const TxDescription& tx)
+{
+    if (tx.m_txType == TxType::PushTransaction && !tx.m_sender)
+    {
+        return QString::fromStdString(tx.getSenderIdentity());
+    }
+    return toString(tx.m_sender ? tx.m_myId : tx.m_peerId);
+}
+
+QString getTxAddressTo(const TxDescription& tx)
+{
+    if (tx.m_sender)
+    {
+        auto token = tx.getToken();
+        if (token.empty())
+        {
+            return toString(tx.m_peerId);
+        }
+        return QString::fromStdString(token);
+    }
+    return toString(tx.m_myId);
+}
+
+TxAddressType getTxAddressType(const TxDescription& tx)
+{
+    auto addressType = tx.GetParameter<TxAddressType>(TxParameterID::AddressType);
+    return addressType ? *addressType : TxAddressType::Unknown;
+}
+
+bool isTxActive(TxStatus status)
+{
+    return status == TxStatus::Pending ||
+           status == TxStatus::InProgress ||
+           status == TxStatus::Registering ||
+           status == TxStatus::Confirming;
+}
+
+bool isTxInProgress(TxStatus status)
+{
+    switch (status)
+    {
+        case TxStatus::Pending:
+        case TxStatus::InProgress:
+        case TxStatus::Registering:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool txHasPaymentProof(TxType type, TxStatus status, bool income)
+{
+    return !income
+           && status == TxStatus::Completed
+           && (type == TxType::Simple || type == TxType::PushTransaction);
+}
+
+TxStateHeights getTxStateHeights(const TxDescription& tx)
+{
+    TxStateHeights heights;
+    heights.minHeight = getHeight(tx, TxParameterID::MinHeight);
+    heights.responseTime = getHeight(tx, TxParameterID::PeerResponseTime);
+    heights.maxHeight = getHeight(tx, TxParameterID::MaxHeight);
+    heights.lifetime = getHeight(tx, TxParameterID::Lifetime);
+    return heights;
+}
+
+QString getTxStateDetails(TxType type, TxStatus status, bool sender, const TxStateHeights& heights)
+{
+    if (isWaitingPeer(type, status))
+    {
+        return waitingPeerStateStr(heights.minHeight, heights.responseTime, sender);
+    }
+
+    if (status == TxStatus::Registering)
+    {
+        if (type == TxType::Simple)
+        {
+            return inProgressStateStr(heights.maxHeight, heights.lifetime);
+        }
+        if (type == TxType::PushTransaction)
+        {
+            //% "The transaction is usually expected to complete in a few minutes."
+            return qtTrId("tx-state-in-progress-normal");
+        }
+    }
+    return "";
+}
+
+Height getTxStateRefreshHeight(TxType type, TxStatus status, const TxStateHeights& heights, Height currentHeight)
+{
+    // follows the branches of getTxStateDetails
+    if (isWaitingPeer(type, status))
+    {
+        return waitingPeerStateRefreshHeight(heights.minHeight, heights.responseTime, currentHeight);
+    }
+    if (type == TxType::Simple && status == TxStatus::Registering)
+    {
+        return inProgressStateRefreshHeight(heights.maxHeight, heights.lifetime, currentHeight);
+    }
+    return 0;
+}
+
+QString getTxConfirmationProgress(uint32_t minConfirmations, Height kernelProofHeight)
+{
+    if (minConfirmations)
+    {
+        auto currHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
+        if (currHeight)
+        {
+            Height blocksAfter = 0;
+            if (kernelProofHeight)
+            {
+                blocksAfter = currHeight - kernelProofHeight;
+            }
+            return QString("%1/%2").arg(std::min<Height>(blocksAfter, minConfirmations)).arg(minConfirmations);
+        }
+    }
+    return "unknown";
+}
+
+QString getTxAmountSecondCurrency(const std::vector<TxAssetAmount>& assets, const QString& secondCurrencyUnit)
+{
+    // TODO: support multiple assets
+    if (assets.size() == 1)
+    {
+        const auto& asset = assets.front();
+        auto amount = QMLGlobals::calcAmountInSecondCurrency(
+            AmountToUIString(asset.amount),
+            asset.rate ? AmountToUIString(asset.rate) : "0",
+            secondCurrencyUnit);
+
+        if (!amount.isEmpty())
+        {
+            return amount;
+        }
+    }
+    return "0";
+}
@@ -0,0 +1,74 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <vector>
+#include "wallet/core/common.h"
+#include "bvm/ManagerStd.h"
+
+//
+// Values derived from a transaction description. Shared by TxObject, which derives them on demand,
+// and TxRow, which derives them once when the table row is built
+//
+struct TxContractInfo
+{
+    beam::Amount fee = 0UL;
+    beam::bvm2::FundsMap spend;
+    QString cids;
+};
+
+struct TxAssetAmount
+{
+    beam::Asset::ID id = beam::Asset::s_BeamID;
+    beam::Amount amount = 0;
+    beam::Amount rate = 0;
+    bool income = false;
+};
+
+// Heights the state details depend on, 0 if the parameter is not set
+struct TxStateHeights
+{
+    beam::Height minHeight = 0;
+    beam::Height responseTime = 0;
+    beam::Height maxHeight = 0;
+    beam::Height lifetime = 0;
+};
+
+// Fee, spend and contract ids of a contract transaction, only the default fee for other types
+TxContractInfo getTxContractInfo(const beam::wallet::TxDescription& tx);
+// Amounts moved by the transaction, rates are in the second currency
+std::vector<TxAssetAmount> getTxAssets(const beam::wallet::TxDescription& tx, const TxContractInfo& contract, const beam::wallet::Currency& secondCurrency);
+beam::Amount getTxAmountGeneral(const beam::wallet::TxDescription& tx, const std::vector<TxAssetAmount>& assets);
+beam::Amount getTxFee(const beam::wallet::TxDescription& tx, const TxContractInfo& contract);
+bool isTxIncome(const beam::wallet::TxDescription& tx, const TxContractInfo& contract);
+bool isTxFeeOnly(const beam::wallet::TxDescription& tx, const TxContractInfo& contract);
+
+QString getTxSource(const beam::wallet::TxDescription& tx);
+QString getTxComment(const beam::wallet::TxDescription& tx);
+QString getTxAppId(const beam::wallet::TxDescription& tx);
+QString getTxAddressFrom(const beam::wallet::TxDescription& tx);
+QString getTxAddressTo(const beam::wallet::TxDescription& tx);
+beam::wallet::TxAddressType getTxAddressType(const beam::wallet::TxDescription& tx);
+
+bool isTxActive(beam::wallet::TxStatus status);
+bool isTxInProgress(beam::wallet::TxStatus status);
+bool txHasPaymentProof(beam::wallet::TxType type, beam::wallet::TxStatus status, bool income);
+
+TxStateHeights getTxStateHeights(const beam::wallet::TxDescription& tx);
+QString getTxStateDetails(beam::wallet::TxType type, beam::wallet::TxStatus status, bool sender, const TxStateHeights& heights);
+// First height at which the state details read differently, 0 if they never change
+beam::Height getTxStateRefreshHeight(beam::wallet::TxType type, beam::wallet::TxStatus status, const TxStateHeights& heights, beam::Height currentHeight);
+QString getTxConfirmationProgress(uint32_t minConfirmations, beam::Height kernelProofHeight);
+QString getTxAmountSecondCurrency(const std::vector<TxAssetAmount>& assets, const QString& secondCurrencyUnit);
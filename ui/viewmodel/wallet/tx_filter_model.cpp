@@ -0,0 +1,310 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_filter_model.h"
+#include <algorithm>
+#include <optional>
+
+TxFilterModel::TxFilterModel(TxObjectList& source, QObject* parent)
+    : QSortFilterProxyModel(parent)
+    , m_source(source)
+{
+    // must run before the proxy handles the same signals and asks filterAcceptsRow
+    connect(&m_source, &QAbstractItemModel::rowsInserted, this, &TxFilterModel::onRowsInserted);
+    connect(&m_source, &QAbstractItemModel::rowsRemoved, this, &TxFilterModel::onRowsRemoved);
+    connect(&m_source, &QAbstractItemModel::rowsMoved, this, &TxFilterModel::onRowsMoved);
+    connect(&m_source, &QAbstractItemModel::modelReset, this, &TxFilterModel::onModelReset);
+    connect(&m_source, &QAbstractItemModel::dataChanged, this, &TxFilterModel::onDataChanged);
+    onModelReset();
+
+    setSourceModel(&m_source);
+    setDynamicSortFilter(true);
+
+    connect(&m_source, &TxObjectList::historyChanged, this, &TxFilterModel::updateActiveCount);
+}
+
+void TxFilterModel::setStatuses(uint32_t hidden, uint32_t required)
+{
+    if (m_hiddenStatuses != hidden || m_requiredStatuses != required)
+    {
+        m_hiddenStatuses = hidden;
+        m_requiredStatuses = required;
+        refilter(StatusCriterion, Scope::All);
+    }
+}
+
+void TxFilterModel::setAssets(std::vector<beam::Asset::ID> assets)
+{
+    std::sort(assets.begin(), assets.end());
+    assets.erase(std::unique(assets.begin(), assets.end()), assets.end());
+    if (assets == m_assets)
+    {
+        return;
+    }
+
+    // empty set stands for all assets
+    auto scope = Scope::All;
+    if (m_assets.empty() || (!assets.empty() && std::includes(m_assets.begin(), m_assets.end(), assets.begin(), assets.end())))
+    {
+        scope = Scope::Passing;
+    }
+    else if (assets.empty() || std::includes(assets.begin(), assets.end(), m_assets.begin(), m_assets.end()))
+    {
+        scope = Scope::Rejected;
+    }
+
+    m_assets = std::move(assets);
+    refilter(AssetCriterion, scope);
+}
+
+void TxFilterModel::setDapp(bool dappsOnly, const QString& appId)
+{
+    if (m_dappsOnly != dappsOnly || m_appId != appId)
+    {
+        m_dappsOnly = dappsOnly;
+        m_appId = appId;
+        refilter(DappCriterion, Scope::All);
+    }
+}
+
+void TxFilterModel::setSearchText(const QString& text)
+{
+    auto normalized = SearchIndex<beam::wallet::TxID>::normalize(text);
+    if (m_searchText == normalized)
+    {
+        return;
+    }
+
+    // typing extends the query, so usually only the rows still matching have to be checked again
+    auto scope = Scope::All;
+    if (normalized.contains(m_searchText))
+    {
+        scope = Scope::Passing;
+    }
+    else if (m_searchText.contains(normalized))
+    {
+        scope = Scope::Rejected;
+    }
+
+    m_searchText = std::move(normalized);
+    refilter(SearchCriterion, scope);
+}
+
+int TxFilterModel::getActiveCount() const
+{
+    return m_activeCount;
+}
+
+bool TxFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const
+{
+    if (sourceParent.isValid())
+    {
+        return false;
+    }
+
+    return (getState(sourceRow) & AllCriteria) == 0;
+}
+
+uint32_t TxFilterModel::getStatusFlags(const TxRow& row)
+{
+    // confirming transactions are both in progress and completed
+    uint32_t flags = 0;
+    if (row.isInProgress()) flags |= InProgress;
+    if (row.isCompleted())  flags |= Completed;
+    if (row.isCanceled())   flags |= Canceled;
+    if (row.isFailed())     flags |= Failed;
+    if (row.isSent())       flags |= Sent;
+    if (row.isReceived())   flags |= Received;
+    return flags;
+}
+
+uint8_t TxFilterModel::check(int row, uint8_t criteria) const
+{
+    const auto& value = m_source.at(row);
+    uint8_t rejected = 0;
+
+    if ((criteria & StatusCriterion) && (m_hiddenStatuses || m_requiredStatuses))
+    {
+        const auto flags = getStatusFlags(value);
+        if ((flags & m_hiddenStatuses) || (flags & m_requiredStatuses) != m_requiredStatuses)
+        {
+            rejected |= StatusCriterion;
+        }
+    }
+
+    if ((criteria & AssetCriterion) && !m_assets.empty())
+    {
+        const auto& assets = value.getAssets();
+        const bool any = std::any_of(assets.begin(), assets.end(), [this](const auto& asset)
+        {
+            return std::binary_search(m_assets.begin(), m_assets.end(), asset.id);
+        });
+
+        if (!any)
+        {
+            rejected |= AssetCriterion;
+        }
+    }
+
+    if (criteria & DappCriterion)
+    {
+        if ((m_dappsOnly && !value.isDappTx()) ||
+            (!m_appId.isEmpty() && value.getAppId().compare(m_appId, Qt::CaseInsensitive) != 0))
+        {
+            rejected |= DappCriterion;
+        }
+    }
+
+    if ((criteria & SearchCriterion) && !m_searchText.isEmpty())
+    {
+        if (!m_source.matchesSearch(row, m_searchText))
+        {
+            rejected |= SearchCriterion;
+        }
+    }
+
+    return rejected;
+}
+
+uint8_t TxFilterModel::getState(int row) const
+{
+    auto& state = m_states[row];
+    if (!(state & Evaluated))
+    {
+        state = (state & Counted) | Evaluated | check(row, AllCriteria);
+    }
+    return state;
+}
+
+void TxFilterModel::refilter(uint8_t criterion, Scope scope)
+{
+    // a new query goes through the search index once instead of matching every row
+    std::optional<SearchIndex<beam::wallet::TxID>::KeySet> matches;
+    if (criterion == SearchCriterion && !m_searchText.isEmpty())
+    {
+        matches = m_source.search(m_searchText);
+    }
+
+    bool changed = false;
+    for (size_t row = 0; row < m_states.size(); ++row)
+    {
+        auto& state = m_states[row];
+        if (!(state & Evaluated))
+        {
+            continue;
+        }
+
+        const bool wasRejected = state & criterion;
+        if ((scope == Scope::Passing && wasRejected) || (scope == Scope::Rejected && !wasRejected))
+        {
+            continue;
+        }
+
+        const uint8_t rejected = matches
+            ? (matches->count(m_source.at(int(row)).getTxID()) ? 0 : SearchCriterion)
+            : check(int(row), criterion);
+        const uint8_t next = (state & ~criterion) | rejected;
+        changed |= ((state & AllCriteria) == 0) != ((next & AllCriteria) == 0);
+        const bool recheck = (state ^ next) & CountCriteria;
+        state = next;
+        if (recheck)
+        {
+            recount(int(row), int(row));
+        }
+    }
+
+    // the proxy rebuilds its mapping from the states, nothing is checked again
+    if (changed)
+    {
+        invalidateFilter();
+    }
+
+    updateActiveCount();
+}
+
+void TxFilterModel::recount(int first, int last)
+{
+    for (int row = first; row <= last; ++row)
+    {
+        const uint8_t state = getState(row);
+        const bool counted = state & Counted;
+        const bool active = (state & CountCriteria) == 0 && m_source.at(row).isActive();
+        if (counted != active)
+        {
+            m_states[row] ^= Counted;
+            m_loadedActive += active ? 1 : -1;
+        }
+    }
+}
+
+void TxFilterModel::updateActiveCount()
+{
+    const int count = m_loadedActive + m_source.getHistoryActiveCount();
+    if (m_activeCount != count)
+    {
+        m_activeCount = count;
+        emit activeCountChanged();
+    }
+}
+
+void TxFilterModel::onRowsInserted(const QModelIndex&, int first, int last)
+{
+    m_states.insert(m_states.begin() + first, last - first + 1, 0);
+    recount(first, last);
+    updateActiveCount();
+}
+
+void TxFilterModel::onRowsRemoved(const QModelIndex&, int first, int last)
+{
+    m_loadedActive -= static_cast<int>(std::count_if(m_states.begin() + first, m_states.begin() + last + 1, [](uint8_t state)
+    {
+        return state & Counted;
+    }));
+    m_states.erase(m_states.begin() + first, m_states.begin() + last + 1);
+    updateActiveCount();
+}
+
+void TxFilterModel::onRowsMoved(const QModelIndex&, int start, int end, const QModelIndex&, int row)
+{
+    std::vector<uint8_t> moved(m_states.begin() + start, m_states.begin() + end + 1);
+    m_states.erase(m_states.begin() + start, m_states.begin() + end + 1);
+    const int to = row > start ? row - int(moved.size()) : row;
+    m_states.insert(m_states.begin() + to, moved.begin(), moved.end());
+}
+
+void TxFilterModel::onModelReset()
+{
+    m_states.assign(m_source.rowCount(), 0);
+    m_loadedActive = 0;
+    recount(0, int(m_states.size()) - 1);
+    updateActiveCount();
+}
+
+void TxFilterModel::onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+{
+    // role specific changes (locale, asset info) never affect the criteria
+    if (!roles.isEmpty())
+    {
+        return;
+    }
+
+    const int last = std::min(bottomRight.row(), int(m_states.size()) - 1);
+    for (int row = topLeft.row(); row <= last; ++row)
+    {
+        m_states[row] &= Counted;
+    }
+
+    // the activity may have changed along with the criteria
+    recount(topLeft.row(), last);
+    updateActiveCount();
+}
@@ -0,0 +1,111 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QSortFilterProxyModel>
+#include <vector>
+#include "tx_object_list.h"
+
+//
+// Filters the transactions table on the rows kept in TxObjectList, without going back to the wallet.
+// All criteria are checked in one pass reading TxRow directly, no QVariant round trip per row.
+// Each row remembers which criteria reject it, so changing one criterion re-checks only that one,
+// and narrowing the search or the asset set re-checks only the rows still passing it
+//
+class TxFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+public:
+    enum StatusFlag : uint32_t
+    {
+        InProgress = 1 << 0,
+        Completed  = 1 << 1,
+        Canceled   = 1 << 2,
+        Failed     = 1 << 3,
+        Sent       = 1 << 4,
+        Received   = 1 << 5,
+    };
+
+    explicit TxFilterModel(TxObjectList& source, QObject* parent = nullptr);
+
+    // Rows having any of the hidden flags are hidden, rows missing any of the required flags as well
+    void setStatuses(uint32_t hidden, uint32_t required);
+
+    // Only rows having at least one of these assets are shown, empty set shows all
+    void setAssets(std::vector<beam::Asset::ID> assets);
+
+    // dappsOnly shows only application transactions, non empty appId only the ones of this application
+    void setDapp(bool dappsOnly, const QString& appId);
+
+    // Case insensitive substring match over the search text of the row, answered by the list search index
+    void setSearchText(const QString& text);
+
+    // Active transactions passing the asset, dapp & search criteria, status criteria are ignored.
+    // Rows of the history not loaded yet are counted too, while no criterion is set they are not loaded anyway
+    [[nodiscard]] int getActiveCount() const;
+
+signals:
+    void activeCountChanged();
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
+
+private:
+    enum Criterion : uint8_t
+    {
+        StatusCriterion = 1 << 0,
+        AssetCriterion  = 1 << 1,
+        DappCriterion   = 1 << 2,
+        SearchCriterion = 1 << 3,
+        AllCriteria     = StatusCriterion | AssetCriterion | DappCriterion | SearchCriterion,
+        CountCriteria   = AssetCriterion | DappCriterion | SearchCriterion,
+        Counted         = 1 << 6,   // the row is in m_loadedActive
+        Evaluated       = 1 << 7,
+    };
+
+    enum class Scope
+    {
+        All,
+        Passing,    // the criterion became stricter, only rows passing it may change
+        Rejected,   // the criterion became looser, only rows rejected by it may change
+    };
+
+    static uint32_t getStatusFlags(const TxRow& row);
+
+    uint8_t check(int row, uint8_t criteria) const;
+    uint8_t getState(int row) const;
+    void refilter(uint8_t criterion, Scope scope);
+    void recount(int first, int last);
+    void updateActiveCount();
+
+    // keep the row states aligned with the source rows, connected before the proxy itself
+    void onRowsInserted(const QModelIndex& parent, int first, int last);
+    void onRowsRemoved(const QModelIndex& parent, int first, int last);
+    void onRowsMoved(const QModelIndex& parent, int start, int end, const QModelIndex& destination, int row);
+    void onModelReset();
+    void onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles);
+
+    TxObjectList& m_source;
+    uint32_t m_hiddenStatuses = 0;
+    uint32_t m_requiredStatuses = 0;
+    std::vector<beam::Asset::ID> m_assets;  // sorted
+    bool m_dappsOnly = false;
+    QString m_appId;
+    QString m_searchText;   // normalized
+
+    // rejecting criteria per source row, rows without the Evaluated bit are checked on demand
+    mutable std::vector<uint8_t> m_states;
+    int m_loadedActive = 0;
+    int m_activeCount = 0;
+};
@@ -13,78 +13,13 @@
 // limitations under the License.
 #include "tx_object.h"
 #include "viewmodel/ui_helpers.h"
-#include "viewmodel/qml_globals.h"
 #include "wallet/core/common.h"
-#include "wallet/core/simple_transaction.h"
 #include "wallet/core/strings_resources.h"
 #include "model/app_model.h"
 
 using namespace beam;
 using namespace beamui;
 
-namespace
-{
-    QString getWaitingPeerStr(const beam::wallet::TxParameters& txParameters, bool isSender)
-    {
-        using namespace beam::wallet;
-
-        auto minHeight = txParameters.GetParameter<beam::Height>(TxParameterID::MinHeight);
-        auto responseTime = txParameters.GetParameter<beam::Height>(TxParameterID::PeerResponseTime);
-        QString time = "";
-        if (minHeight && responseTime)
-        {
-            time = convertBeamHeightDiffToTime(*minHeight + *responseTime - AppModel::getInstance().getWalletModel()->getCurrentHeight());
-        }
-        if (isSender)
-        {
-            //% "If the receiver doesn't get online in %1, the transaction will be canceled"
-            return qtTrId("tx-state-initial-sender").arg(time);
-        }
-        //% "If the sender doesn't get online in %1, the transaction will be canceled"
-        return qtTrId("tx-state-initial-receiver").arg(time);
-    }
-
-    QString getInProgressStr(const beam::wallet::TxParameters& txParameters)
-    {
-        using namespace beam::wallet;
-
-        const Height kNormalTxConfirmationDelay = 10;
-        auto maxHeight = txParameters.GetParameter<beam::Height>(TxParameterID::MaxHeight);
-        QString time = "";
-        if (!maxHeight)
-        {
-            return "";
-        }
-
-        auto currentHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
-        if (currentHeight >= *maxHeight)
-        {
-            return "";
-        }
-
-        Height delta =  *maxHeight - currentHeight;
-        auto lifetime = txParameters.GetParameter<beam::Height>(TxParameterID::Lifetime);
-        if (!lifetime || *lifetime < delta)
-        {
-            return "";
-        }
-
-        if (*lifetime - delta <= kNormalTxConfirmationDelay)
-        {
-            //% "The transaction is usually expected to complete in a few minutes."
-            return qtTrId("tx-state-in-progress-normal");
-        }
-
-        time = beamui::convertBeamHeightDiffToTime(delta);
-        if (time.isEmpty())
-        {
-            return "";
-        }
-        //% "It is taking longer than usual. In case the transaction could not be completed it will be canceled automatically in %1."
-        return qtTrId("tx-state-in-progress-long").arg(time);
-    }
-}
-
 TxObject::TxObject(beam::wallet::TxDescription tx, QObject* parent)
     : TxObject(std::move(tx), beam::wallet::Currency::UNKNOWN(), parent)
 {
@@ -95,92 +30,39 @@ TxObject::TxObject(beam::wallet::TxDescription tx, beam::wallet::Currency second
     , _tx(std::move(tx))
     , _secondCurrency(secondCurrency)
 {
-    using namespace beam;
     using namespace beam::wallet;
 
-    Height h = tx.m_minHeight;
-    _contractFee = std::max(_tx.m_fee, Transaction::FeeSettings::get(h).get_DefaultStd());
-
-    auto appendAsset = [&](Asset::ID aid, Amount amount, bool income) {
-        _assetAmounts.push_back(AmountToUIString(amount));
-        _assetsList.push_back(aid);
-        _assetAmountsIncome.push_back(income);
-        _assetRates.push_back(getRate(aid));
-    };
-
-    if (_tx.m_txType == wallet::TxType::Contract)
+    // cheap enough to keep the early failure, the amounts themselves are read on demand
+    if (_tx.m_txType == TxType::DexSimpleSwap &&
+        (!_tx.GetParameter<Asset::ID>(TxParameterID::DexReceiveAsset) || !_tx.GetParameter<Amount>(TxParameterID::DexReceiveAmount)))
     {
-        bvm2::ContractInvokeData vData;
-        if(_tx.GetParameter(TxParameterID::ContractDataPacked, vData))
-        {
-            _contractFee = bvm2::getFullFee(vData, h);
-            _contractSpend = bvm2::getFullSpend(vData);
-        }
-
-        if (!vData.empty())
-        {
-            std::stringstream ss;
-            ss << vData[0].m_Cid.str();
-
-            if (vData.size() > 1)
-            {
-                ss << " +" << vData.size() - 1;
-            }
-
-            _contractCids = QString::fromStdString(ss.str());
-        }
-
-        for (const auto& info: _contractSpend)
-        {
-            auto amount = info.second;
-            if (info.first == beam::Asset::s_BeamID)
-            {
-                if (amount < 0)
-                {
-                    amount += _contractFee;
-                }
-            }
-            appendAsset(info.first, std::abs(amount), amount <= 0);
-        }
-
-        if (isFeeOnly())
-        {
-            appendAsset(0, _contractFee, false);
-        }
+        throw std::runtime_error("No rasset/ramount on DEX tx");
     }
-    else if (_tx.m_txType == beam::wallet::TxType::DexSimpleSwap)
-    {
-        const auto rasset  = _tx.GetParameter<Asset::ID>(TxParameterID::DexReceiveAsset);
-        const auto ramount = _tx.GetParameter<Amount>(TxParameterID::DexReceiveAmount);
-        if (!rasset || !ramount)
-        {
-            throw std::runtime_error("No rasset/ramount on DEX tx");
-        }
+}
 
-        appendAsset(*rasset, *ramount, true);
-        appendAsset(_tx.m_assetId, _tx.m_amount, false);
-    }
-    else
+const TxContractInfo& TxObject::getContractData() const
+{
+    return _contract.get([this]()
     {
-        appendAsset(_tx.m_assetId, _tx.m_amount, !_tx.m_sender);
-    }
+        return getTxContractInfo(_tx);
+    });
+}
 
-    if (!_tx.m_appName.empty())
-    {
-        _source = QString::fromStdString(_tx.m_appName);
-    }
-    else if (_tx.m_txType == wallet::TxType::DexSimpleSwap)
-    {
-        //% "Assets Swap"
-        _source = qtTrId("source-dex");
-    }
-    else
+const TxObject::AssetData& TxObject::getAssetData() const
+{
+    return _assets.get([this]()
     {
-        //% "Wallet"
-        _source = qtTrId("source-wallet");
-    }
-
-    _tx.GetParameter(beam::wallet::TxParameterID::MinConfirmations, _minConfirmations);
+        AssetData data;
+        data.assets = getTxAssets(_tx, getContractData(), _secondCurrency);
+        for (const auto& asset: data.assets)
+        {
+            data.list.push_back(asset.id);
+            data.amounts.push_back(AmountToUIString(asset.amount));
+            data.amountsIncome.push_back(asset.income);
+            data.rates.push_back(asset.rate ? AmountToUIString(asset.rate) : "0");
+        }
+        return data;
+    });
 }
 
 bool TxObject::operator==(const TxObject& other) const
@@ -195,38 +77,33 @@ beam::Timestamp TxObject::timeCreated() const
 
 QString TxObject::getSource() const
 {
-    return _source;
+    return _source.get([this]()
+    {
+        return getTxSource(_tx);
+    });
 }
 
 uint32_t TxObject::getMinConfirmations() const
 {
-    return _tx.m_txType == wallet::TxType::Simple ? _minConfirmations : 0;
+    return _tx.m_txType == wallet::TxType::Simple ? getMinConfirmationsParam() : 0;
 }
 
-QString TxObject::getConfirmationProgress() const
+uint32_t TxObject::getMinConfirmationsParam() const
 {
-    if (_minConfirmations)
+    return _minConfirmations.get([this]()
     {
-        auto currHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
-        if (currHeight && _minConfirmations)
-        {
-            if (auto proofHeight = _tx.GetParameter<Height>(wallet::TxParameterID::KernelProofHeight); proofHeight)
-            {
-                std::stringstream ss;
-                auto blocksAfter = (currHeight - *proofHeight);
-                ss << (blocksAfter > _minConfirmations ? _minConfirmations : blocksAfter) << "/" << _minConfirmations;
-                return QString::fromStdString(ss.str());
-            }
-            else
-            {
-                std::stringstream ss;
-                ss << 0 << "/" << _minConfirmations;
-                return QString::fromStdString(ss.str());
-            }
-        }
-    }
+        uint32_t minConfirmations = 0;
+        _tx.GetParameter(beam::wallet::TxParameterID::MinConfirmations, minConfirmations);
+        return minConfirmations;
+    });
+}
 
-    return "unknown";
+QString TxObject::getConfirmationProgress() const
+{
+    // depends on the current height, so it is never memoized
+    Height proofHeight = 0;
+    _tx.GetParameter(wallet::TxParameterID::KernelProofHeight, proofHeight);
+    return getTxConfirmationProgress(getMinConfirmationsParam(), proofHeight);
 }
 
 beam::wallet::TxID TxObject::getTxID() const
@@ -236,52 +113,15 @@ beam::wallet::TxID TxObject::getTxID() const
 
 bool TxObject::isIncome() const
 {
-    if (isContractTx())
-    {
-        if (isFeeOnly())
-        {
-            // this is a fee-only transaction
-            return false;
-        }
-
-        for (const auto& info : _contractSpend) {
-            if (info.second > 0)
-                return false;
-        }
-
-        return true;
-    }
-    else
-    {
-        return !_tx.m_sender;
-    }
+    return isTxIncome(_tx, getContractData());
 }
 
 const QString& TxObject::getComment() const
 {
-    if (_comment.isEmpty())
+    return _comment.get([this]()
     {
-        std::string str{_tx.m_message.begin(), _tx.m_message.end()};
-        auto comment = QString(str.c_str()).trimmed();
-
-        if (isContractTx())
-        {
-            if (comment.isEmpty())
-            {
-                //% "Contract transaction"
-                comment = qtTrId("tx-contract-default-comment");
-            }
-        }
-        else if (isDexTx())
-        {
-            // TODO:DEX just temporary
-            comment = "DEX transaction";
-        }
-
-        _comment = comment;
-    }
-
-    return _comment;
+        return getTxComment(_tx);
+    });
 }
 
 QString TxObject::getRate(beam::Asset::ID assetId) const
@@ -299,7 +139,7 @@ QString TxObject::getFeeRate() const
 
 QString TxObject::getCidsStr() const
 {
-    return _contractCids;
+    return getContractData().cids;
 }
 
 QString TxObject::getRate() const
@@ -309,12 +149,7 @@ QString TxObject::getRate() const
 
 bool TxObject::isActive() const
 {
-    using namespace beam::wallet;
-
-    return _tx.m_status == TxStatus::Pending ||
-           _tx.m_status == TxStatus::InProgress ||
-           _tx.m_status == TxStatus::Registering ||
-           _tx.m_status == TxStatus::Confirming;
+    return isTxActive(_tx.m_status);
 }
 
 QString TxObject::getStatus() const
@@ -322,6 +157,11 @@ QString TxObject::getStatus() const
     return beam::wallet::interpretStatus(_tx).c_str();
 }
 
+TxStatusCode TxObject::getStatusCode() const
+{
+    return parseTxStatus(beam::wallet::interpretStatus(_tx), getAddressType());
+}
+
 bool TxObject::isCancelAvailable() const
 {
     return _tx.canCancel();
@@ -334,63 +174,24 @@ bool TxObject::isDeleteAvailable() const
 
 QString TxObject::getAddressFrom() const
 {
-    if (_tx.m_txType == wallet::TxType::PushTransaction && !_tx.m_sender)
-    {
-        return getSenderIdentity();
-    }
-    return toString(_tx.m_sender ? _tx.m_myId : _tx.m_peerId);
+    return getTxAddressFrom(_tx);
 }
 
 QString TxObject::getAddressTo() const
 {
-    if (_tx.m_sender)
-    {
-        auto token = getToken();
-        if (token.isEmpty())
-            return toString(_tx.m_peerId);
-
-        return token;
-    }
-    return toString(_tx.m_myId);
+    return getTxAddressTo(_tx);
 }
 
 QString TxObject::getAmountGeneral() const
 {
-    if (isContractTx())
-    {
-        return *_assetAmounts.begin();
-    }
-    else
-    {
-        return AmountToUIString(_tx.m_amount);
-    }
+    return AmountToUIString(getTxAmountGeneral(_tx, getAssetData().assets));
 }
 
 
 QString TxObject::getFee() const
 {
-    if (isContractTx())
-    {
-        if (_contractFee)
-        {
-            return AmountToUIString(_contractFee);
-        }
-    }
-    else if (_tx.m_fee)
-    {
-        // TODO(zavarza) no fee for shielded inputs after HF3
-        Amount shieldedInputsFee = 0;
-        std::vector<wallet::IPrivateKeyKeeper2::ShieldedInput> inputsShielded;
-        if (_tx.GetParameter(wallet::TxParameterID::InputCoinsShielded, inputsShielded))
-        {
-            for (const auto& inputShielded : inputsShielded)
-            {
-                shieldedInputsFee += inputShielded.m_Fee;
-            }
-        }
-        return AmountToUIString(shieldedInputsFee + _tx.m_fee);
-    }
-    return QString{};
+    const auto fee = getTxFee(_tx, getContractData());
+    return fee ? AmountToUIString(fee) : QString{};
 }
 
 const beam::wallet::TxDescription& TxObject::getTxDescription() const
@@ -400,19 +201,21 @@ const beam::wallet::TxDescription& TxObject::getTxDescription() const
 
 QString TxObject::getKernelID() const
 {
-    if (_kernelIDStr.isEmpty())
+    return _kernelIDStr.get([this]()
     {
-        _kernelIDStr = QString::fromStdString(to_hex(_tx.m_kernelID.m_pData, static_cast<size_t>(_tx.m_kernelID.nBytes)));
-    }
-    return _kernelIDStr;
+        return QString::fromStdString(to_hex(_tx.m_kernelID.m_pData, static_cast<size_t>(_tx.m_kernelID.nBytes)));
+    });
 }
 
 QString TxObject::getTransactionID() const
 {
-    return QString::fromStdString(to_hex(_tx.m_txId.data(), _tx.m_txId.size()));
+    return _transactionIDStr.get([this]()
+    {
+        return QString::fromStdString(to_hex(_tx.m_txId.data(), _tx.m_txId.size()));
+    });
 }
 
-QString TxObject::getReasonString(beam::wallet::TxFailureReason reason) const
+QString TxObject::getReasonString(beam::wallet::TxFailureReason reason)
 {
     // clang doesn't allow to make 'auto reasons' so for the moment assertions below are a bit pointles
     // let's wait until they fix template arg deduction and restore it back
@@ -550,54 +353,15 @@ QString TxObject::getFailureReason() const
 
 QString TxObject::getStateDetails() const
 {
-    auto& tx = getTxDescription();
-    if (tx.m_txType == beam::wallet::TxType::Simple)
-    {
-        switch (tx.m_status)
-        {
-        case beam::wallet::TxStatus::Pending:
-        case beam::wallet::TxStatus::InProgress:
-        {
-            auto state = tx.GetParameter<wallet::SimpleTransaction::State>(beam::wallet::TxParameterID::State);
-            if (state)
-            {
-                switch (*state)
-                {
-                case wallet::SimpleTransaction::Initial:
-                case wallet::SimpleTransaction::Invitation:
-                    return getWaitingPeerStr(tx, tx.m_sender);
-                default:
-                    break;
-                }
-            }
-            return getWaitingPeerStr(tx, tx.m_sender);
-        }
-        case beam::wallet::TxStatus::Registering:
-            return getInProgressStr(tx);
-        default:
-            break;
-        }
-    }
-
-    if (tx.m_txType == beam::wallet::TxType::PushTransaction)
-    {
-        if (tx.m_status == beam::wallet::TxStatus::InProgress)
-        {
-            return getWaitingPeerStr(tx, tx.m_sender);
-        }
-        else if (tx.m_status == beam::wallet::TxStatus::Registering)
-        {
-            //% "The transaction is usually expected to complete in a few minutes."
-            return qtTrId("tx-state-in-progress-normal");
-        }
-    }
-    return "";
+    return getTxStateDetails(_tx.m_txType, _tx.m_status, _tx.m_sender, getTxStateHeights(_tx));
 }
 
 QString TxObject::getToken() const
 {
-    const auto& tx = getTxDescription();
-    return QString::fromStdString(tx.getToken());
+    return _token.get([this]()
+    {
+        return QString::fromStdString(_tx.getToken());
+    });
 }
 
 QString TxObject::getSenderIdentity() const
@@ -612,38 +376,22 @@ QString TxObject::getReceiverIdentity() const
 
 bool TxObject::isMultiAsset() const
 {
-    return _assetsList.size() > 1;
+    return getAssetData().list.size() > 1;
 }
 
 bool TxObject::canShowContractNotification() const
 {
-    if (isContractTx() && isActive())
-    {
-        bool isMarkedAsRead = false;
-        _tx.GetParameter(beam::wallet::TxParameterID::IsContractNotificationMarkedAsRead, isMarkedAsRead);
-        return !isMarkedAsRead;
-    }
-    return false;
+    return TransactionsStore::needsContractNotification(_tx);
 }
 
 bool TxObject::hasPaymentProof() const
 {
-    return !isIncome()
-           && _tx.m_status == beam::wallet::TxStatus::Completed
-           && (_tx.m_txType == beam::wallet::TxType::Simple || _tx.m_txType == beam::wallet::TxType::PushTransaction);
+    return txHasPaymentProof(_tx.m_txType, _tx.m_status, isIncome());
 }
 
 bool TxObject::isInProgress() const
 {
-    switch (_tx.m_status)
-    {
-        case wallet::TxStatus::Pending:
-        case wallet::TxStatus::InProgress:
-        case wallet::TxStatus::Registering:
-            return true;
-        default:
-            return false;
-    }
+    return isTxInProgress(_tx.m_status);
 }
 
 bool TxObject::isPending() const
@@ -676,35 +424,25 @@ bool TxObject::isDexTx() const
     return _tx.m_txType == beam::wallet::TxType::DexSimpleSwap;
 }
 
-QString TxObject::getAppId()
+QString TxObject::getAppId() const
 {
-    if (!_appid.is_initialized())
+    return _appid.get([this]()
     {
-        if(auto appid = _tx.GetParameter<std::string>(beam::wallet::TxParameterID::AppID))
-        {
-            _appid = QString::fromStdString(*appid);
-        }
-        else
-        {
-            _appid = "";
-        }
-    }
-    return *_appid;
+        return getTxAppId(_tx);
+    });
 }
 
-bool TxObject::isDappTx()
+bool TxObject::isDappTx() const
 {
     return !getAppId().isEmpty();
 }
 
-beam::wallet::TxAddressType TxObject::getAddressType()
+beam::wallet::TxAddressType TxObject::getAddressType() const
 {
-    if (!_addressType)
+    return _addressType.get([this]()
     {
-        _addressType = _tx.GetParameter<beam::wallet::TxAddressType>(beam::wallet::TxParameterID::AddressType);
-    }
-
-    return _addressType ? *_addressType : beam::wallet::TxAddressType::Unknown;
+        return getTxAddressType(_tx);
+    });
 }
 
 bool TxObject::isSent() const
@@ -734,47 +472,33 @@ bool TxObject::isExpired() const
 
 const std::vector<beam::Asset::ID>& TxObject::getAssetsList() const
 {
-    return _assetsList;
+    return getAssetData().list;
 }
 
 bool TxObject::isFeeOnly() const
 {
-    return isContractTx() && _contractSpend.empty();
+    return isTxFeeOnly(_tx, getContractData());
 }
 
 const std::vector<QString>& TxObject::getAssetAmounts() const
 {
-    return _assetAmounts;
+    return getAssetData().amounts;
 }
 
 const std::vector<bool>& TxObject::getAssetAmountsIncome() const
 {
-    return _assetAmountsIncome;
+    return getAssetData().amountsIncome;
 }
 
 const std::vector<QString>& TxObject::getAssetRates() const
 {
-    return _assetRates;
+    return getAssetData().rates;
 }
 
-QString TxObject::getAmountSecondCurrency()
+QString TxObject::getAmountSecondCurrency() const
 {
-    if (_amountSecondCurrency.isEmpty())
-    {
-        // TODO: support multiple assets
-        if (_assetsList.size() == 1)
-        {
-            _amountSecondCurrency = QMLGlobals::calcAmountInSecondCurrency(
-                _assetAmounts[0],
-                _assetRates[0],
-                QString::fromStdString(_secondCurrency.m_value).toUpper());
-        }
-    }
-
-    if (_amountSecondCurrency.isEmpty())
+    return _amountSecondCurrency.get([this]()
     {
-        _amountSecondCurrency = "0";
-    }
-
-    return _amountSecondCurrency;
+        return getTxAmountSecondCurrency(getAssetData().assets, QString::fromStdString(_secondCurrency.m_value).toUpper());
+    });
 }
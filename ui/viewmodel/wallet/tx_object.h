@@ -17,10 +17,17 @@
 #include <QDateTime>
 #include "viewmodel/payment_item.h"
 #include "viewmodel/ui_helpers.h"
+#include "tx_details.h"
+#include "tx_status.h"
 #include "wallet/client/extensions/news_channels/interface.h"
-#include "bvm/ManagerStd.h"
 #include "model/assets_list.h"
+#include "viewmodel/helpers/lazy_value.h"
 
+//
+// Presentation of a single transaction. Only the description is copied on construction,
+// every derived value (contract data, asset amounts, strings) is computed on first access
+// and kept for the lifetime of the object
+//
 class TxObject: public QObject
 {
     Q_OBJECT
@@ -42,20 +49,21 @@ public:
     QString getTransactionID() const ;
     bool hasPaymentProof() const;
     virtual QString getStatus() const;
+    virtual TxStatusCode getStatusCode() const;
     virtual QString getFailureReason() const;
     virtual QString getStateDetails() const;
     QString getToken() const;
     QString getSenderIdentity() const;
     QString getReceiverIdentity() const;
     QString getFeeRate() const;
-    QString getAmountSecondCurrency();
+    QString getAmountSecondCurrency() const;
     QString getCidsStr() const;
     QString getSource() const;
     uint32_t getMinConfirmations() const;
     QString getConfirmationProgress() const;
     bool isActive() const;
-    QString getAppId();
-    bool isDappTx();
+    QString getAppId() const;
+    bool isDappTx() const;
     bool isFeeOnly() const;
 
     const std::vector<beam::Asset::ID>& getAssetsList() const;
@@ -68,7 +76,7 @@ public:
     bool isShieldedTx() const;
     bool isContractTx() const;
     bool isDexTx() const;
-    beam::wallet::TxAddressType getAddressType();
+    beam::wallet::TxAddressType getAddressType() const;
     bool isSent() const;
     bool isReceived() const;
     virtual bool isCancelAvailable() const;
@@ -82,27 +90,37 @@ public:
     virtual bool isMultiAsset() const;
     bool canShowContractNotification() const;
 
+    [[nodiscard]] static QString getReasonString(beam::wallet::TxFailureReason reason);
+
 protected:
     [[nodiscard]] const beam::wallet::TxDescription& getTxDescription() const;
-    [[nodiscard]] QString getReasonString(beam::wallet::TxFailureReason reason) const;
 
     beam::wallet::TxDescription _tx;
-    uint32_t _minConfirmations = 0;
     beam::wallet::Currency _secondCurrency;
-    QString _amountSecondCurrency;
 
-    mutable QString _kernelIDStr;
-    mutable QString _comment;
-    boost::optional<beam::wallet::TxAddressType> _addressType;
-    boost::optional<QString> _appid;
+private:
+    struct AssetData
+    {
+        std::vector<TxAssetAmount>   assets;
+        std::vector<beam::Asset::ID> list;
+        std::vector<QString>         amounts;
+        std::vector<bool>            amountsIncome;
+        std::vector<QString>         rates;
+    };
 
-    beam::Amount _contractFee = 0UL;
-    beam::bvm2::FundsMap _contractSpend;
-    QString _contractCids;
-    QString _source;
+    const TxContractInfo& getContractData() const;
+    const AssetData& getAssetData() const;
+    uint32_t getMinConfirmationsParam() const;
 
-    std::vector<beam::Asset::ID> _assetsList;
-    std::vector<QString>         _assetAmounts;
-    std::vector<bool>            _assetAmountsIncome;
-    std::vector<QString>         _assetRates;
+    LazyValue<TxContractInfo> _contract;
+    LazyValue<AssetData> _assets;
+    LazyValue<uint32_t> _minConfirmations;
+    LazyValue<QString> _amountSecondCurrency;
+    LazyValue<QString> _kernelIDStr;
+    LazyValue<QString> _transactionIDStr;
+    LazyValue<QString> _comment;
+    LazyValue<QString> _source;
+    LazyValue<QString> _token;
+    LazyValue<QString> _appid;
+    LazyValue<beam::wallet::TxAddressType> _addressType;
 };
@@ -15,224 +15,39 @@
 #include "tx_object_list.h"
 #include "model/app_model.h"
 #include "viewmodel/qml_globals.h"
+#include <algorithm>
+#include <unordered_set>
 
 namespace
 {
-QString getStatusTextTranslated(const QString& status, beam::wallet::TxAddressType addressType)
-{
-    if (status == "pending")
-    {
-        //% "pending"
-        return qtTrId("wallet-txs-status-pending");
-    }
-    else if (status == "waiting for sender")
-    {
-        //% "waiting for sender"
-        return qtTrId("wallet-txs-status-waiting-sender");
-    }
-    else if (status == "waiting for receiver")
-    {
-        if (addressType != beam::wallet::TxAddressType::Offline)
-        {
-            //% "waiting for receiver"
-            return qtTrId("wallet-txs-status-waiting-receiver");
-        }
-        else
-        {
-            /*% "waiting for receiver
-(offline)"*/
-            return qtTrId("wallet-txs-status-waiting-receiver-offline");
-        }
-    }
-    else if (status == "in progress")
-    {
-        //% "in progress"
-        return qtTrId("wallet-txs-status-in-progress");
-    }
-    else if (status == "sent to own address")
-    {
-        //% "sent to own address"
-        return qtTrId("wallet-txs-status-own-sent");
-    }
-    else if (status == "sending to own address")
-    {
-        //% "sending to own address"
-        return qtTrId("wallet-txs-status-own-sending");
-    }
-    else if (status == "received")
-    {
-        //% "received"
-        return qtTrId("wallet-txs-status-received");
-    }
-    else if (status == "sent")
-    {
-        //% "sent"
-        return qtTrId("wallet-txs-status-sent");
-    }
-    else if (status == "cancelled")
-    {
-        //% "canceled"
-        return qtTrId("wallet-txs-status-cancelled");
-    }
-    else if (status == "expired")
-    {
-        //% "expired"
-        return qtTrId("wallet-txs-status-expired");
-    }
-    else if (status == "failed")
-    {
-        //% "failed"
-        return qtTrId("wallet-txs-status-failed");
-    }
-    // in progress
-    else if (status == "in progress maximum anonymity")
-    {
-        /*% "in progress
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-in-progress-max");
-    }
-    else if (status == "sending maximum anonymity to own address")
-    {
-        /*% "sending to own address
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-in-progress-max-to-own");
-    }
-    else if (status == "in progress offline")
-    {
-        /*% "in progress (offline)" */
-        return qtTrId("wallet-txs-status-in-progress-max-offline");
-    }
-    else if (status == "in progress public offline")
-    {
-        /*% "in progress
-(public offline)" */
-        return qtTrId("wallet-txs-status-in-progress-public-offline");
-    }
-    else if (status == "sending offline to own address")
-    {
-        /*% "sending to own address
-(offline)" */
-        return qtTrId("wallet-txs-status-in-progress-offline-to-own");
-    }
-    else if (status == "sending public offline to own address")
-    {
-        /*% "sending to own address
-(public offline)" */
-        return qtTrId("wallet-txs-status-in-progress-pub-offline-to-own");
-    }
-    // sent
-    else if (status == "sent maximum anonymity")
-    {
-        /*% "sent
-(maximum anonymity)"*/
-        return qtTrId("wallet-txs-status-sent-max");
-    }
-    else if (status == "sent offline")
-    {
-        /*% "sent (offline)" */
-        return qtTrId("wallet-txs-status-sent-max-offline");
-    }
-    else if (status == "sent public offline")
-    {
-        /*% "sent
-(public offline)" */
-        return qtTrId("wallet-txs-status-sent-public-offline");
-    }
-    else if (status == "sent maximum anonymity to own address")
-    {
-        /*% "sent to own address
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-sent-max-to-own");
-    }
-    else if (status == "sent offline to own address")
-    {
-        /*% "sent to own address
-(offline)" */
-        return qtTrId("wallet-txs-status-sent-offline-to-own");
-    }
-    else if (status == "sent public offline to own address")
-    {
-        /*% "sent to own address
-(public offline)" */
-        return qtTrId("wallet-txs-status-sent-pub-offline-to-own");
-    }
-    // received
-    else if (status == "received maximum anonymity")
-    {
-        /*% "received
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-received-max");
-    }
-    else if (status == "received offline")
-    {
-        /*% "received (offline)" */
-        return qtTrId("wallet-txs-status-received-max-offline");
-    }
-    else if (status == "received public offline")
-    {
-        /*% "received
-(public offline)" */
-        return qtTrId("wallet-txs-status-received-public-offline");
-    }
-    // canceled
-    else if (status == "canceled maximum anonymity")
-    {
-        /*% "canceled
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-canceled-max");
-    }
-    else if (status == "canceled offline")
-    {
-        /*% "canceled (offline)" */
-        return qtTrId("wallet-txs-status-canceled-max-offline");
-    }
-    else if (status == "canceled public offline")
-    {
-        /*% "canceled
-(public offline)" */
-        return qtTrId("wallet-txs-status-canceled-public-offline");
-    }
-    // failed
-    else if (status == "failed maximum anonymity")
-    {
-        /*% "failed
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-failed-max");
-    }
-    else if (status == "failed offline")
-    {
-        /*% "failed (offline)" */
-        return qtTrId("wallet-txs-status-failed-max-offline");
-    }
-    else if (status == "failed public offline")
-    {
-        /*% "failed
-(public offline)" */
-        return qtTrId("wallet-txs-status-failed-public-offline");
-    }
-    else if (status == "completed")
-    {
-        //% "completed"
-        return qtTrId("wallet-txs-status-completed");
-    }
-    else if (status == "confirming")
-    {
-        //% "confirming"
-        return qtTrId("wallet-txs-status-confirming");
-    }
-    else
-    {
-        //% "unknown"
-        return qtTrId("wallet-txs-status-unknown");
-    }
+    const size_t kHistoryPageSize = 100;
 }
 
-}  // namespace
-
 TxObjectList::TxObjectList()
     : _amgr(AppModel::getInstance().getAssets())
+    , m_assetRows(*this, [](const TxRow& row, AssetRowIndex<TxRow, beam::wallet::TxID>::AssetIDs& ids)
+    {
+        for (const auto& asset : row.getAssets())
+        {
+            ids.push_back(asset.id);
+        }
+    })
+    , m_refreshSchedule(*this, [](const TxRow& row)
+    {
+        return row.getRefreshHeight(AppModel::getInstance().getWalletModel()->getCurrentHeight());
+    })
 {
-    connect(_amgr.get(), &AssetsManager::assetInfo, this, &TxObjectList::onAssetInfo);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged, this, &TxObjectList::onAssetsInfo);
+    connect(&AppModel::getInstance().getSettings(), &WalletSettings::localeChanged, this, &TxObjectList::onLocaleChanged);
+    connect(AppModel::getInstance().getWalletModel().get(), &WalletModel::walletStatusChanged, this, &TxObjectList::onWalletStatus);
+
+    // connected before any view, so the cache is in shape by the time views query new rows
+    connect(this, &QAbstractItemModel::rowsAboutToBeRemoved, this, &TxObjectList::onRowsAboutToBeRemoved);
+    connect(this, &QAbstractItemModel::rowsInserted, this, &TxObjectList::onRowsInserted);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, &TxObjectList::onRowsRemoved);
+    connect(this, &QAbstractItemModel::rowsMoved, this, &TxObjectList::onRowsMoved);
+    connect(this, &QAbstractItemModel::modelReset, this, &TxObjectList::onModelReset);
+    connect(this, &QAbstractItemModel::dataChanged, this, &TxObjectList::onDataChanged);
 }
 
 QHash<int, QByteArray> TxObjectList::roleNames() const
@@ -318,241 +133,489 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
     switch (static_cast<Roles>(role))
     {
         case Roles::IsFeeOnly:
-            return value->isFeeOnly();
+            return value.isFeeOnly();
         case Roles::Source:
         case Roles::SourceSort:
-            return value->getSource();
+            return value.getSource();
         case Roles::Action:
         case Roles::ActionSort:
-            return value->isContractTx() ? value->getComment() : "";
+            return value.isContractTx() ? value.getComment() : "";
         case Roles::TimeCreated:
-        {
-            QDateTime datetime;
-            datetime.setTime_t(value->timeCreated());
-            return datetime.toString(m_locale.dateTimeFormat(QLocale::ShortFormat));
-        }
+            return getCache(index.row(), RowCache::LocaleText).timeCreated;
         case Roles::TimeCreatedSort:
-            return static_cast<qulonglong>(value->timeCreated());
+            return static_cast<qulonglong>(value.timeCreated());
         case Roles::AmountGeneralSort:
-            return static_cast<qulonglong>(beamui::UIStringToAmount(value->getAmountGeneral()));
+            return static_cast<qulonglong>(value.getAmountGeneralValue());
         case Roles::AmountGeneral:
-            return value->getAmountGeneral();
+            return value.getAmountGeneral();
         case Roles::Rate:
-            return value->getRate();
+            return value.getRate();
         case Roles::FeeRate:
-            return value->getFeeRate();
+            return value.getFeeRate();
         case Roles::AddressFrom:
-            return value->getAddressFrom();
+            return value.getAddressFrom();
         case Roles::AddressTo:
-            return value->getAddressTo();
+            return value.getAddressTo();
         case Roles::Status:
+        {
+            // the progress moves with the height, only the localized base text is cached
+            const auto& status = getCache(index.row(), RowCache::LocaleText).status;
+            if (value.getStatus().kind == TxStatusKind::Confirming)
+            {
+                return status + " (" + value.getConfirmationProgress() + ")";
+            }
+            return status;
+        }
         case Roles::StatusSort:
-            return value->getStatus() == "confirming"
-                ? getStatusTextTranslated(value->getStatus(), value->getAddressType()) + " (" + value->getConfirmationProgress() + ")"
-                : getStatusTextTranslated(value->getStatus(), value->getAddressType());
+            return value.getStatus().toInt();
         case Roles::Fee:
-            return value->getFee();
+            return value.getFee();
         case Roles::Comment:
-            return value->getComment();
+            return value.getComment();
         case Roles::TxID:
-            return value->getTransactionID();
+            return value.getTransactionID();
         case Roles::KernelID:
-            return value->getKernelID();
+            return value.getKernelID();
         case Roles::FailureReason:
-            return value->getFailureReason();
+            return value.getFailureReason();
         case Roles::IsCancelAvailable:
-            return value->isCancelAvailable();
+            return value.isCancelAvailable();
         case Roles::IsDeleteAvailable:
-            return value->isDeleteAvailable();
+            return value.isDeleteAvailable();
         case Roles::IsSelfTransaction:
-            return value->isSelfTx();
+            return value.isSelfTx();
         case Roles::IsShieldedTx:
-            return value->isShieldedTx();
+            return value.isShieldedTx();
         case Roles::IsOfflineToken:
-            return value->getAddressType() == beam::wallet::TxAddressType::Offline;
+            return value.getAddressType() == beam::wallet::TxAddressType::Offline;
         case Roles::IsPublicOffline:
-            return value->getAddressType() == beam::wallet::TxAddressType::PublicOffline;
+            return value.getAddressType() == beam::wallet::TxAddressType::PublicOffline;
         case Roles::IsMaxPrivacy:
-            return value->getAddressType() == beam::wallet::TxAddressType::MaxPrivacy;
+            return value.getAddressType() == beam::wallet::TxAddressType::MaxPrivacy;
         case Roles::CidsStr:
-            return value->getCidsStr();
+            return value.getCidsStr();
         case Roles::IsContractTx:
-            return value->isContractTx();
+            return value.isContractTx();
         case Roles::IsDexTx:
-            return value->isDexTx();
+            return value.isDexTx();
         case Roles::IsIncome:
-            return value->isIncome();
+            return value.isIncome();
         case Roles::IsInProgress:
-            return value->isInProgress();
+            return value.isInProgress();
         case Roles::IsPending:
-            return value->isPending();
+            return value.isPending();
         case Roles::IsCompleted:
-            return value->isCompleted();
+            return value.isCompleted();
         case Roles::IsSent:
-            return value->isSent();
+            return value.isSent();
         case Roles::IsReceived:
-            return value->isReceived();
+            return value.isReceived();
         case Roles::IsCanceled:
-            return value->isCanceled();
+            return value.isCanceled();
         case Roles::IsFailed:
-            return value->isFailed();
+            return value.isFailed();
         case Roles::IsExpired:
-            return value->isExpired();
+            return value.isExpired();
         case Roles::HasPaymentProof:
-            return value->hasPaymentProof();
+            return value.hasPaymentProof();
         case Roles::RawTxID:
-            return QVariant::fromValue(value->getTxID());
-        case Roles::Search: 
-        {
-            QString r = value->getTransactionID();
-            r.append(" ");
-            r.append(value->getKernelID());
-            r.append(" ");
-            r.append(value->getAddressFrom());
-            r.append(" ");
-            r.append(value->getAddressTo());
-            r.append(" ");
-            r.append(value->getComment());
-            r.append(" ");
-            r.append(value->getSenderIdentity());
-            r.append(" ");
-            r.append(value->getReceiverIdentity());
-            r.append(" ");
-            r.append(value->getToken());
-            return r;
-        }
+            return QVariant::fromValue(value.getTxID());
+        case Roles::Search:
+            return makeSearchText(value);
         case Roles::StateDetails:
-            return value->getStateDetails();
+            return value.getStateDetails();
         case Roles::Token:
-            return value->getToken();
+            return value.getToken();
         case Roles::SenderIdentity:
-            return value->getSenderIdentity();
+            return value.getSenderIdentity();
         case Roles::ReceiverIdentity:
-            return value->getReceiverIdentity();
+            return value.getReceiverIdentity();
         case Roles::AssetNamesSort:
-        {
-            QString names;
-            const auto& alist = value->getAssetsList();
-            for(const auto& assetID: alist)
-            {
-                if (!names.isEmpty())
-                {
-                    names += ",";
-                }
-                names += _amgr->getUnitName(assetID, AssetsManager::NoShorten);
-            }
-            return names;
-        }
+            return getCache(index.row(), RowCache::AssetText).assetNamesSort;
         case Roles::AssetNames:
-        {
-            QList<QString> namesList;
-            const auto& alist = value->getAssetsList();
-            for(const auto& assetID: alist)
-            {
-               namesList.append(_amgr->getUnitName(assetID, AssetsManager::NoShorten));
-            }
-            QVariant result;
-            result.setValue(namesList);
-            return result;
-        }
+            return getCache(index.row(), RowCache::AssetText).assetNames;
         case Roles::AssetVerified:
-        {
-            QList<bool> verifiedList;
-            const auto& alist = value->getAssetsList();
-            for(const auto& assetID: alist)
-            {
-                verifiedList.append(_amgr->isVerified(assetID));
-            }
-            QVariant result;
-            result.setValue(verifiedList);
-            return result;
-        }
+            return getCache(index.row(), RowCache::AssetText).assetVerified;
         case Roles::AssetIcons:
-        {
-            QList<QString> iconsList;
-            const auto& alist = value->getAssetsList();
-            for(const auto& assetID: alist)
-            {
-                iconsList.append(_amgr->getIcon(assetID));
-            }
-            QVariant result;
-            result.setValue(iconsList);
-            return result;
-        }
+            return getCache(index.row(), RowCache::AssetText).assetIcons;
         case Roles::AssetAmounts:
         {
-            const auto& amounts = value->getAssetAmounts();
+            const auto& amounts = value.getAssetAmounts();
             QVariant result;
             result.setValue(amounts);
             return result;
         }
         case Roles::AssetAmountsIncome:
         {
-            const auto& amounts = value->getAssetAmountsIncome();
+            const auto& amounts = value.getAssetAmountsIncome();
             QVariant result;
             result.setValue(amounts);
             return result;
         }
         case Roles::AssetRates:
         {
-            const auto& rates = value->getAssetRates();
+            const auto& rates = value.getAssetRates();
             QVariant result;
             result.setValue(rates);
             return result;
         }
         case Roles::AssetIDs:
         {
-            const auto& assets = value->getAssetsList();
+            const auto& assets = value.getAssetsList();
             QVariant result;
             result.setValue(assets);
             return result;
         }
         case Roles::AssetFilter:
-        {
-            const auto& alist = value->getAssetsList();
-
-            QString r;
-            for(const auto aid: alist) {
-                if (!r.isEmpty()) {
-                    r += ",";
-                }
-                r += QString::number(aid);
-            }
-
-            return r;
-        }
+            return getCache(index.row(), RowCache::RowText).assetFilter;
         case Roles::AmountSecondCurrencySort:
-            return static_cast<qulonglong>(beamui::UIStringToAmount(value->getAmountSecondCurrency()));
+            return static_cast<qulonglong>(value.getAmountSecondCurrencyValue());
         case Roles::AmountSecondCurrency:
-            return value->getAmountSecondCurrency();
+            return value.getAmountSecondCurrency();
         case Roles::IsMultiAsset:
-            return value->isMultiAsset();
+            return value.isMultiAsset();
         case Roles::MinConfirmations:
-            return value->getMinConfirmations();
+            return value.getMinConfirmations();
         case Roles::ConfirmationsProgress:
-            return value->getConfirmationProgress();
+            return value.getConfirmationProgress();
         case Roles::IsDappTx:
-            return value->isDappTx();
+            return value.isDappTx();
         case Roles::DAppId:
-            return value->getAppId();
+            return value.getAppId();
         case Roles::DAppName:
-            return value->isContractTx() ? value->getSource() : "";
+            return value.isContractTx() ? value.getSource() : "";
         case Roles::IsActive:
-            return value->isActive();
+            return value.isActive();
         default:
             return QVariant();
     }
 }
 
-void TxObjectList::onAssetInfo(beam::Asset::ID assetId)
+void TxObjectList::resetHistory(std::vector<TxRow> history, bool all)
+{
+    std::sort(history.begin(), history.end(), [](const auto& left, const auto& right)
+    {
+        return left.timeCreated() < right.timeCreated();
+    });
+
+    m_history = std::move(history);
+    m_historyActive = static_cast<int>(std::count_if(m_history.begin(), m_history.end(), [](const auto& row)
+    {
+        return row.isActive();
+    }));
+    reset(takeHistory(all ? m_history.size() : kHistoryPageSize, false));
+    emit historyChanged();
+}
+
+void TxObjectList::dropHistory(const std::vector<TxRow>& rows)
+{
+    if (m_history.empty() || rows.empty())
+    {
+        return;
+    }
+
+    std::unordered_set<beam::wallet::TxID, ListModelKeyHash> ids;
+    for (const auto& row : rows)
+    {
+        ids.insert(row.getTxID());
+    }
+
+    m_history.erase(std::remove_if(m_history.begin(), m_history.end(), [this, &ids](const auto& row)
+    {
+        if (ids.find(row.getTxID()) == ids.end())
+        {
+            return false;
+        }
+        m_historyActive -= row.isActive() ? 1 : 0;
+        return true;
+    }), m_history.end());
+    emit historyChanged();
+}
+
+void TxObjectList::fetchAll()
+{
+    if (!m_history.empty())
+    {
+        insert(takeHistory(m_history.size(), true));
+        emit historyChanged();
+    }
+}
+
+int TxObjectList::getHistoryActiveCount() const
+{
+    return m_historyActive;
+}
+
+bool TxObjectList::canFetchMore(const QModelIndex& parent) const
+{
+    return !parent.isValid() && !m_history.empty();
+}
+
+void TxObjectList::fetchMore(const QModelIndex& parent)
+{
+    if (!parent.isValid())
+    {
+        insert(takeHistory(kHistoryPageSize, true));
+        emit historyChanged();
+    }
+}
+
+std::vector<TxRow> TxObjectList::takeHistory(size_t count, bool skipLoaded)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it)
+    std::vector<TxRow> rows;
+    rows.reserve(std::min(count, m_history.size()));
+    while (rows.size() < count && !m_history.empty())
     {
-        const auto& alist = (*it)->getAssetsList();
-        if(std::find(alist.begin(), alist.end(), assetId) != alist.end())
+        // a row loaded by an update is newer than what the history has
+        m_historyActive -= m_history.back().isActive() ? 1 : 0;
+        if (skipLoaded && contains(m_history.back().getTxID()))
         {
-            const auto idx = it - m_list.begin();
-            ListModel::touch(idx);
+            m_history.pop_back();
+            continue;
         }
+
+        rows.push_back(std::move(m_history.back()));
+        m_history.pop_back();
+    }
+
+    if (m_history.empty())
+    {
+        m_history.shrink_to_fit();
+    }
+    return rows;
+}
+
+beam::wallet::TxID TxObjectList::getKey(const TxRow& item) const
+{
+    return item.getTxID();
+}
+
+bool TxObjectList::hasChanged(const TxRow& prev, const TxRow& next) const
+{
+    // active transactions show height dependent details, always repaint them
+    return next.isActive() || !prev.hasSameData(next);
+}
+
+QVector<int> TxObjectList::getChangedRoles(const TxRow& prev, const TxRow& next) const
+{
+    if (!prev.hasSameData(next))
+    {
+        return {};
+    }
+
+    // same data of an active transaction, only what depends on the current height may differ
+    return
+    {
+        static_cast<int>(Roles::Status),
+        static_cast<int>(Roles::StateDetails),
+        static_cast<int>(Roles::ConfirmationsProgress)
+    };
+}
+
+void TxObjectList::onAssetsInfo(const QSet<beam::Asset::ID>& assets)
+{
+    auto rows = m_assetRows.getRows(assets);
+    for (auto row : rows)
+    {
+        invalidateCache(row, row, RowCache::AssetText);
+    }
+
+    emitDataChanged(std::move(rows),
+    {
+        static_cast<int>(Roles::AssetNames),
+        static_cast<int>(Roles::AssetNamesSort),
+        static_cast<int>(Roles::AssetVerified),
+        static_cast<int>(Roles::AssetIcons)
+    });
+}
+
+void TxObjectList::onWalletStatus()
+{
+    const auto height = AppModel::getInstance().getWalletModel()->getCurrentHeight();
+    if (height == m_height)
+    {
+        return;
+    }
+    m_height = height;
+
+    emitDataChanged(m_refreshSchedule.takeDue(height),
+    {
+        static_cast<int>(Roles::Status),
+        static_cast<int>(Roles::StateDetails),
+        static_cast<int>(Roles::ConfirmationsProgress)
+    });
+}
+
+void TxObjectList::onLocaleChanged()
+{
+    m_statusTexts.rebuild();
+    if (m_list.isEmpty())
+    {
+        return;
+    }
+
+    invalidateCache(0, m_list.size() - 1, RowCache::LocaleText);
+    emit dataChanged(createIndex(0, 0), createIndex(m_list.size() - 1, 0),
+    {
+        static_cast<int>(Roles::TimeCreated),
+        static_cast<int>(Roles::Status),
+        static_cast<int>(Roles::StatusSort),
+        static_cast<int>(Roles::FailureReason),
+        static_cast<int>(Roles::StateDetails)
+    });
+}
+
+SearchIndex<beam::wallet::TxID>::KeySet TxObjectList::search(const QString& text) const
+{
+    return m_searchIndex.find(text);
+}
+
+bool TxObjectList::matchesSearch(int row, const QString& normalizedText) const
+{
+    return m_searchIndex.matches(getKey(m_list[row]), normalizedText);
+}
+
+QString TxObjectList::makeSearchText(const TxRow& value)
+{
+    QString text = value.getTransactionID();
+    text.append(" ");
+    text.append(value.getKernelID());
+    text.append(" ");
+    text.append(value.getAddressFrom());
+    text.append(" ");
+    text.append(value.getAddressTo());
+    text.append(" ");
+    text.append(value.getComment());
+    text.append(" ");
+    text.append(value.getSenderIdentity());
+    text.append(" ");
+    text.append(value.getReceiverIdentity());
+    text.append(" ");
+    text.append(value.getToken());
+    return text;
+}
+
+void TxObjectList::indexRows(int first, int last)
+{
+    for (int row = first; row <= last && row < m_list.size(); ++row)
+    {
+        m_searchIndex.insert(getKey(m_list[row]), makeSearchText(m_list[row]));
+    }
+}
+
+const TxObjectList::RowCache& TxObjectList::getCache(int row, RowCache::Group group) const
+{
+    auto& cache = m_cache[row];
+    if (cache.valid & group)
+    {
+        return cache;
+    }
+
+    const auto& value = m_list[row];
+    switch (group)
+    {
+        case RowCache::RowText:
+        {
+            cache.assetFilter.clear();
+            for(const auto& asset: value.getAssets())
+            {
+                if (!cache.assetFilter.isEmpty())
+                {
+                    cache.assetFilter += ",";
+                }
+                cache.assetFilter += QString::number(asset.id);
+            }
+
+            break;
+        }
+        case RowCache::LocaleText:
+        {
+            QDateTime datetime;
+            datetime.setTime_t(value.timeCreated());
+            cache.timeCreated = datetime.toString(m_locale.dateTimeFormat(QLocale::ShortFormat));
+
+            cache.status = m_statusTexts.get(value.getStatus());
+            break;
+        }
+        case RowCache::AssetText:
+        {
+            QList<QString> namesList;
+            QList<bool> verifiedList;
+            QList<QString> iconsList;
+            cache.assetNamesSort.clear();
+            for(const auto& asset: value.getAssets())
+            {
+                const auto name = _amgr->getUnitName(asset.id, AssetsManager::NoShorten);
+                if (!cache.assetNamesSort.isEmpty())
+                {
+                    cache.assetNamesSort += ",";
+                }
+                cache.assetNamesSort += name;
+                namesList.append(name);
+                verifiedList.append(_amgr->isVerified(asset.id));
+                iconsList.append(_amgr->getIcon(asset.id));
+            }
+            cache.assetNames.setValue(namesList);
+            cache.assetVerified.setValue(verifiedList);
+            cache.assetIcons.setValue(iconsList);
+            break;
+        }
+    }
+
+    cache.valid |= group;
+    return cache;
+}
+
+void TxObjectList::invalidateCache(int first, int last, uint8_t groups)
+{
+    for (int row = first; row <= last && row < int(m_cache.size()); ++row)
+    {
+        m_cache[row].valid &= ~groups;
+    }
+}
+
+void TxObjectList::onRowsAboutToBeRemoved(const QModelIndex&, int first, int last)
+{
+    for (int row = first; row <= last; ++row)
+    {
+        m_searchIndex.remove(getKey(m_list[row]));
+    }
+}
+
+void TxObjectList::onRowsInserted(const QModelIndex&, int first, int last)
+{
+    m_cache.insert(m_cache.begin() + first, last - first + 1, RowCache());
+    indexRows(first, last);
+}
+
+void TxObjectList::onRowsRemoved(const QModelIndex&, int first, int last)
+{
+    m_cache.erase(m_cache.begin() + first, m_cache.begin() + last + 1);
+}
+
+void TxObjectList::onRowsMoved(const QModelIndex&, int start, int end, const QModelIndex&, int row)
+{
+    std::vector<RowCache> moved(std::make_move_iterator(m_cache.begin() + start), std::make_move_iterator(m_cache.begin() + end + 1));
+    m_cache.erase(m_cache.begin() + start, m_cache.begin() + end + 1);
+    const int to = row > start ? row - int(moved.size()) : row;
+    m_cache.insert(m_cache.begin() + to, std::make_move_iterator(moved.begin()), std::make_move_iterator(moved.end()));
+}
+
+void TxObjectList::onModelReset()
+{
+    m_cache.clear();
+    m_cache.resize(m_list.size());
+
+    m_searchIndex.clear();
+    indexRows(0, m_list.size() - 1);
+}
+
+void TxObjectList::onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+{
+    // role specific notifications are sent by the invalidating code itself
+    if (roles.isEmpty())
+    {
+        invalidateCache(topLeft.row(), bottomRight.row(), RowCache::RowText | RowCache::LocaleText | RowCache::AssetText);
+        indexRows(topLeft.row(), bottomRight.row());
     }
 }
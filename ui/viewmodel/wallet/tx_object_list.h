@@ -14,12 +14,16 @@
 
 #pragma once
 
-#include "tx_object.h"
+#include "tx_row.h"
 #include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/search_index.h"
+#include "viewmodel/helpers/asset_row_index.h"
+#include "viewmodel/helpers/refresh_schedule.h"
 #include "model/assets_manager.h"
 #include <QLocale>
+#include <vector>
 
-class TxObjectList : public ListModel<std::shared_ptr<TxObject>>
+class TxObjectList : public ListModel<TxRow, beam::wallet::TxID>
 {
     Q_OBJECT
 public:
@@ -97,10 +101,90 @@ public:
     [[nodiscard]] QVariant data(const QModelIndex &index, int role) const override;
     [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
 
+    // History rows are added to the model page by page, newest first,
+    // only the first page is shown right away, the rest is added when the view scrolls.
+    // Filtered or reordered views need all of it at once
+    void resetHistory(std::vector<TxRow> history, bool all);
+    void dropHistory(const std::vector<TxRow>& rows);
+    void fetchAll();
+    // Active transactions among the history rows not added yet
+    [[nodiscard]] int getHistoryActiveCount() const;
+
+    [[nodiscard]] bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+    // Keys of the loaded rows whose search text contains the given one, case insensitive
+    [[nodiscard]] SearchIndex<beam::wallet::TxID>::KeySet search(const QString& text) const;
+    // Single row check, the text has to be normalized with SearchIndex::normalize
+    [[nodiscard]] bool matchesSearch(int row, const QString& normalizedText) const;
+
+signals:
+    void historyChanged();
+
 private slots:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const QSet<beam::Asset::ID>& assets);
+    void onLocaleChanged();
+    void onWalletStatus();
+
+protected:
+    [[nodiscard]] beam::wallet::TxID getKey(const TxRow& item) const override;
+    [[nodiscard]] bool hasChanged(const TxRow& prev, const TxRow& next) const override;
+    [[nodiscard]] QVector<int> getChangedRoles(const TxRow& prev, const TxRow& next) const override;
 
 private:
+    //
+    // Role values that are expensive to build, computed on the first request and kept
+    // until the row changes. Each group has its own valid bit, so that a locale change
+    // or new asset info drops only the part depending on it
+    //
+    struct RowCache
+    {
+        enum Group : uint8_t
+        {
+            RowText    = 1 << 0,   // depends on the row only
+            LocaleText = 1 << 1,   // status texts & date format
+            AssetText  = 1 << 2,   // asset names, icons & verification
+        };
+
+        uint8_t valid = 0;
+
+        QString assetFilter;
+
+        QString timeCreated;
+        QString status;
+
+        QString assetNamesSort;
+        QVariant assetNames;
+        QVariant assetVerified;
+        QVariant assetIcons;
+    };
+
+    std::vector<TxRow> takeHistory(size_t count, bool skipLoaded);
+
+    static QString makeSearchText(const TxRow& value);
+    void indexRows(int first, int last);
+
+    const RowCache& getCache(int row, RowCache::Group group) const;
+    void invalidateCache(int first, int last, uint8_t groups);
+
+    // keep the cache & the search index aligned with the rows, base model signals are the single source of truth
+    void onRowsAboutToBeRemoved(const QModelIndex& parent, int first, int last);
+    void onRowsInserted(const QModelIndex& parent, int first, int last);
+    void onRowsRemoved(const QModelIndex& parent, int first, int last);
+    void onRowsMoved(const QModelIndex& parent, int start, int end, const QModelIndex& destination, int row);
+    void onModelReset();
+    void onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles);
+
     AssetsManager::Ptr _amgr;
     QLocale m_locale;
+    TxStatusTexts m_statusTexts;
+    mutable std::vector<RowCache> m_cache;
+    SearchIndex<beam::wallet::TxID> m_searchIndex;
+    AssetRowIndex<TxRow, beam::wallet::TxID> m_assetRows;
+    RefreshSchedule<TxRow, beam::wallet::TxID> m_refreshSchedule;
+    beam::Height m_height = 0;
+
+    // not yet shown rows, the newest one is at the back
+    std::vector<TxRow> m_history;
+    int m_historyActive = 0;
 };
@@ -0,0 +1,397 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_row.h"
+#include "tx_object.h"
+#include "viewmodel/ui_helpers.h"
+#include "viewmodel/helpers/fixed_amount.h"
+#include "wallet/core/common.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+using namespace beam;
+using namespace beam::wallet;
+using namespace beamui;
+
+TxRow::TxRow(const TxDescription& tx, const Currency& secondCurrency)
+    : _txId(tx.m_txId)
+    , _kernelId(tx.m_kernelID)
+    , _createTime(tx.m_createTime)
+    , _modifyTime(tx.m_modifyTime)
+    , _stateHeights(getTxStateHeights(tx))
+    , _txType(tx.m_txType)
+    , _status(tx.m_status)
+    , _failureReason(tx.m_failureReason)
+    , _addressType(getTxAddressType(tx))
+    , _sender(tx.m_sender)
+    , _selfTx(tx.m_selfTx)
+    , _canCancel(tx.canCancel())
+    , _canDelete(tx.canDelete())
+{
+    tx.GetParameter(TxParameterID::KernelProofHeight, _kernelProofHeight);
+    tx.GetParameter(TxParameterID::MinConfirmations, _minConfirmations);
+
+    const auto contract = getTxContractInfo(tx);
+    _assets = getTxAssets(tx, contract, secondCurrency);
+    _amount = getTxAmountGeneral(tx, _assets);
+    _fee = getTxFee(tx, contract);
+    _rate = tx.getExchangeRate(secondCurrency, tx.m_assetId);
+    _feeRate = tx.getExchangeRate(secondCurrency, Asset::s_BeamID);
+    _income = isTxIncome(tx, contract);
+    _feeOnly = isTxFeeOnly(tx, contract);
+    _contractCids = contract.cids;
+    _secondCurrencyUnit = QString::fromStdString(secondCurrency.m_value).toUpper();
+
+    _appId = getTxAppId(tx);
+    _source = getTxSource(tx);
+    _comment = getTxComment(tx);
+    _token = QString::fromStdString(tx.getToken());
+    _senderIdentity = QString::fromStdString(tx.getSenderIdentity());
+    _receiverIdentity = QString::fromStdString(tx.getReceiverIdentity());
+    _addressFrom = getTxAddressFrom(tx);
+    _addressTo = getTxAddressTo(tx);
+    _statusCode = parseTxStatus(interpretStatus(tx), _addressType);
+}
+
+beam::Timestamp TxRow::timeCreated() const
+{
+    return _createTime;
+}
+
+beam::Timestamp TxRow::timeModified() const
+{
+    return _modifyTime;
+}
+
+bool TxRow::hasSameData(const TxRow& other) const
+{
+    const auto sameAssets = std::equal(_assets.begin(), _assets.end(), other._assets.begin(), other._assets.end(),
+        [](const AssetAmount& left, const AssetAmount& right)
+        {
+            return left.id == right.id && left.amount == right.amount && left.rate == right.rate && left.income == right.income;
+        });
+
+    return sameAssets
+        && std::tie(_txId, _kernelId, _createTime, _modifyTime, _amount, _fee, _rate, _feeRate,
+                    _stateHeights.minHeight, _stateHeights.responseTime, _stateHeights.maxHeight, _stateHeights.lifetime, _kernelProofHeight, _minConfirmations,
+                    _txType, _status, _failureReason, _addressType, _statusCode,
+                    _sender, _selfTx, _income, _feeOnly, _canCancel, _canDelete,
+                    _comment, _source, _appId, _addressFrom, _addressTo, _token,
+                    _senderIdentity, _receiverIdentity, _contractCids, _secondCurrencyUnit)
+        == std::tie(other._txId, other._kernelId, other._createTime, other._modifyTime, other._amount, other._fee, other._rate, other._feeRate,
+                    other._stateHeights.minHeight, other._stateHeights.responseTime, other._stateHeights.maxHeight, other._stateHeights.lifetime, other._kernelProofHeight, other._minConfirmations,
+                    other._txType, other._status, other._failureReason, other._addressType, other._statusCode,
+                    other._sender, other._selfTx, other._income, other._feeOnly, other._canCancel, other._canDelete,
+                    other._comment, other._source, other._appId, other._addressFrom, other._addressTo, other._token,
+                    other._senderIdentity, other._receiverIdentity, other._contractCids, other._secondCurrencyUnit);
+}
+
+const beam::wallet::TxID& TxRow::getTxID() const
+{
+    return _txId;
+}
+
+beam::Amount TxRow::getAmountGeneralValue() const
+{
+    return _amount;
+}
+
+QString TxRow::getAmountGeneral() const
+{
+    return AmountToUIString(_amount);
+}
+
+QString TxRow::getRate() const
+{
+    return _rate ? AmountToUIString(_rate) : "0";
+}
+
+QString TxRow::getFeeRate() const
+{
+    return _feeRate ? AmountToUIString(_feeRate) : "0";
+}
+
+const QString& TxRow::getComment() const
+{
+    return _comment;
+}
+
+const QString& TxRow::getAddressFrom() const
+{
+    return _addressFrom;
+}
+
+const QString& TxRow::getAddressTo() const
+{
+    return _addressTo;
+}
+
+QString TxRow::getFee() const
+{
+    return _fee ? AmountToUIString(_fee) : QString{};
+}
+
+QString TxRow::getKernelID() const
+{
+    return QString::fromStdString(to_hex(_kernelId.m_pData, static_cast<size_t>(_kernelId.nBytes)));
+}
+
+QString TxRow::getTransactionID() const
+{
+    return QString::fromStdString(to_hex(_txId.data(), _txId.size()));
+}
+
+bool TxRow::hasPaymentProof() const
+{
+    return txHasPaymentProof(_txType, _status, isIncome());
+}
+
+TxStatusCode TxRow::getStatus() const
+{
+    return _statusCode;
+}
+
+QString TxRow::getFailureReason() const
+{
+    return _status == TxStatus::Failed ? TxObject::getReasonString(_failureReason) : QString();
+}
+
+QString TxRow::getStateDetails() const
+{
+    return getTxStateDetails(_txType, _status, _sender, _stateHeights);
+}
+
+const QString& TxRow::getToken() const
+{
+    return _token;
+}
+
+const QString& TxRow::getSenderIdentity() const
+{
+    return _senderIdentity;
+}
+
+const QString& TxRow::getReceiverIdentity() const
+{
+    return _receiverIdentity;
+}
+
+QString TxRow::getAmountSecondCurrency() const
+{
+    return getTxAmountSecondCurrency(_assets, _secondCurrencyUnit);
+}
+
+beam::Amount TxRow::getAmountSecondCurrencyValue() const
+{
+    // same value as getAmountSecondCurrency, in 1e-8 of the second currency, without the string round trip
+    // the product of two amounts needs 128 bits, values past the Amount range sort as the largest one
+    if (_assets.size() == 1)
+    {
+        const auto& asset = _assets.front();
+        const auto decimals = getCurrencyDecimals(Currencies::Beam);
+        const auto value = FixedAmount(asset.amount, decimals).multiply(FixedAmount(asset.rate, decimals), decimals, FixedAmount::Rounding::Down);
+        if (!value || value->getValue() > std::numeric_limits<beam::Amount>::max())
+        {
+            return std::numeric_limits<beam::Amount>::max();
+        }
+        return value->getValue().convert_to<beam::Amount>();
+    }
+    return 0;
+}
+
+const QString& TxRow::getCidsStr() const
+{
+    return _contractCids;
+}
+
+const QString& TxRow::getSource() const
+{
+    return _source;
+}
+
+uint32_t TxRow::getMinConfirmations() const
+{
+    return _txType == TxType::Simple ? _minConfirmations : 0;
+}
+
+QString TxRow::getConfirmationProgress() const
+{
+    return getTxConfirmationProgress(_minConfirmations, _kernelProofHeight);
+}
+
+beam::Height TxRow::getRefreshHeight(beam::Height currentHeight) const
+{
+    Height height = getTxStateRefreshHeight(_txType, _status, _stateHeights, currentHeight);
+    if (_minConfirmations && _kernelProofHeight && currentHeight < _kernelProofHeight + _minConfirmations)
+    {
+        // the confirmations progress ticks with every block
+        height = height ? std::min(height, currentHeight + 1) : currentHeight + 1;
+    }
+    return height;
+}
+
+const QString& TxRow::getAppId() const
+{
+    return _appId;
+}
+
+bool TxRow::isDappTx() const
+{
+    return !_appId.isEmpty();
+}
+
+bool TxRow::isFeeOnly() const
+{
+    return _feeOnly;
+}
+
+const std::vector<TxRow::AssetAmount>& TxRow::getAssets() const
+{
+    return _assets;
+}
+
+std::vector<beam::Asset::ID> TxRow::getAssetsList() const
+{
+    std::vector<beam::Asset::ID> result;
+    result.reserve(_assets.size());
+    for (const auto& asset: _assets)
+    {
+        result.push_back(asset.id);
+    }
+    return result;
+}
+
+std::vector<QString> TxRow::getAssetAmounts() const
+{
+    std::vector<QString> result;
+    result.reserve(_assets.size());
+    for (const auto& asset: _assets)
+    {
+        result.push_back(AmountToUIString(asset.amount));
+    }
+    return result;
+}
+
+std::vector<bool> TxRow::getAssetAmountsIncome() const
+{
+    std::vector<bool> result;
+    result.reserve(_assets.size());
+    for (const auto& asset: _assets)
+    {
+        result.push_back(asset.income);
+    }
+    return result;
+}
+
+std::vector<QString> TxRow::getAssetRates() const
+{
+    std::vector<QString> result;
+    result.reserve(_assets.size());
+    for (const auto& asset: _assets)
+    {
+        result.push_back(asset.rate ? AmountToUIString(asset.rate) : "0");
+    }
+    return result;
+}
+
+bool TxRow::isActive() const
+{
+    return isTxActive(_status);
+}
+
+bool TxRow::isIncome() const
+{
+    return _income;
+}
+
+bool TxRow::isSelfTx() const
+{
+    return _selfTx;
+}
+
+bool TxRow::isShieldedTx() const
+{
+    return _txType == TxType::PushTransaction;
+}
+
+bool TxRow::isContractTx() const
+{
+    return _txType == TxType::Contract;
+}
+
+bool TxRow::isDexTx() const
+{
+    return _txType == TxType::DexSimpleSwap;
+}
+
+beam::wallet::TxAddressType TxRow::getAddressType() const
+{
+    return _addressType;
+}
+
+bool TxRow::isSent() const
+{
+    return isCompleted() && !isIncome();
+}
+
+bool TxRow::isReceived() const
+{
+    return isCompleted() && isIncome();
+}
+
+bool TxRow::isCancelAvailable() const
+{
+    return _canCancel;
+}
+
+bool TxRow::isDeleteAvailable() const
+{
+    return _canDelete;
+}
+
+bool TxRow::isInProgress() const
+{
+    return isTxInProgress(_status);
+}
+
+bool TxRow::isPending() const
+{
+    return _status == TxStatus::Pending;
+}
+
+bool TxRow::isExpired() const
+{
+    return isFailed() && _failureReason == TxFailureReason::TransactionExpired;
+}
+
+bool TxRow::isCompleted() const
+{
+    return _status == TxStatus::Completed || _status == TxStatus::Confirming;
+}
+
+bool TxRow::isCanceled() const
+{
+    return _status == TxStatus::Canceled;
+}
+
+bool TxRow::isFailed() const
+{
+    return _status == TxStatus::Failed;
+}
+
+bool TxRow::isMultiAsset() const
+{
+    return _assets.size() > 1;
+}
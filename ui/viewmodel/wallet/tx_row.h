@@ -0,0 +1,134 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <vector>
+#include "wallet/core/common.h"
+#include "tx_details.h"
+#include "tx_status.h"
+
+//
+// Compact value-type record of a transactions table row.
+// Built once from TxDescription, the parameters map is not kept: amounts and heights
+// are stored as integers, the strings are derived once.
+//
+class TxRow
+{
+public:
+    using AssetAmount = TxAssetAmount;
+
+    TxRow() = default;
+    TxRow(const beam::wallet::TxDescription& tx, const beam::wallet::Currency& secondCurrency);
+
+    beam::Timestamp timeCreated() const;
+    beam::Timestamp timeModified() const;
+    // Field by field, the modification time has a one second resolution and misses quick successive updates
+    bool hasSameData(const TxRow& other) const;
+    const beam::wallet::TxID& getTxID() const;
+    beam::Amount getAmountGeneralValue() const;
+    QString getAmountGeneral() const;
+    QString getRate() const;
+    QString getFeeRate() const;
+    const QString& getComment() const;
+    const QString& getAddressFrom() const;
+    const QString& getAddressTo() const;
+    QString getFee() const;
+    QString getKernelID() const;
+    QString getTransactionID() const;
+    bool hasPaymentProof() const;
+    TxStatusCode getStatus() const;
+    QString getFailureReason() const;
+    QString getStateDetails() const;
+    const QString& getToken() const;
+    const QString& getSenderIdentity() const;
+    const QString& getReceiverIdentity() const;
+    QString getAmountSecondCurrency() const;
+    beam::Amount getAmountSecondCurrencyValue() const;
+    const QString& getCidsStr() const;
+    const QString& getSource() const;
+    uint32_t getMinConfirmations() const;
+    QString getConfirmationProgress() const;
+    // First height at which the state details or the confirmations progress change, 0 if they never do
+    beam::Height getRefreshHeight(beam::Height currentHeight) const;
+    const QString& getAppId() const;
+    bool isDappTx() const;
+    bool isFeeOnly() const;
+
+    const std::vector<AssetAmount>& getAssets() const;
+    std::vector<beam::Asset::ID> getAssetsList() const;
+    std::vector<QString> getAssetAmounts() const;
+    std::vector<bool> getAssetAmountsIncome() const;
+    std::vector<QString> getAssetRates() const;
+
+    bool isActive() const;
+    bool isIncome() const;
+    bool isSelfTx() const;
+    bool isShieldedTx() const;
+    bool isContractTx() const;
+    bool isDexTx() const;
+    beam::wallet::TxAddressType getAddressType() const;
+    bool isSent() const;
+    bool isReceived() const;
+    bool isCancelAvailable() const;
+    bool isDeleteAvailable() const;
+    bool isInProgress() const;
+    bool isPending() const;
+    bool isExpired() const;
+    bool isCompleted() const;
+    bool isCanceled() const;
+    bool isFailed() const;
+    bool isMultiAsset() const;
+
+private:
+    beam::wallet::TxID _txId = {};
+    beam::Merkle::Hash _kernelId = {};
+    beam::Timestamp _createTime = 0;
+    beam::Timestamp _modifyTime = 0;
+    beam::Amount _amount = 0;
+    beam::Amount _fee = 0;
+    beam::Amount _rate = 0;
+    beam::Amount _feeRate = 0;
+
+    // heights used by the state details & confirmations, 0 if not set
+    TxStateHeights _stateHeights;
+    beam::Height _kernelProofHeight = 0;
+    uint32_t _minConfirmations = 0;
+
+    beam::wallet::TxType _txType = beam::wallet::TxType::Simple;
+    beam::wallet::TxStatus _status = beam::wallet::TxStatus::Pending;
+    beam::wallet::TxFailureReason _failureReason = beam::wallet::TxFailureReason::Unknown;
+    beam::wallet::TxAddressType _addressType = beam::wallet::TxAddressType::Unknown;
+    TxStatusCode _statusCode;
+
+    bool _sender = false;
+    bool _selfTx = false;
+    bool _income = false;
+    bool _feeOnly = false;
+    bool _canCancel = false;
+    bool _canDelete = false;
+
+    std::vector<AssetAmount> _assets;
+
+    QString _comment;
+    QString _source;
+    QString _appId;
+    QString _addressFrom;
+    QString _addressTo;
+    QString _token;
+    QString _senderIdentity;
+    QString _receiverIdentity;
+    QString _contractCids;
+    QString _secondCurrencyUnit;
+};
@@ -0,0 +1,176 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_row_builder.h"
+#include <QRunnable>
+#include <QThreadPool>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include "utility/logger.h"
+
+using namespace beam::wallet;
+
+namespace
+{
+    // small update batches are cheaper to build in place than to schedule
+    const size_t kInlineRows = 16;
+    const size_t kMinChunkRows = 64;
+
+    class Job : public QRunnable
+    {
+    public:
+        explicit Job(std::function<void()> job)
+            : m_job(std::move(job))
+        {
+        }
+
+        void run() override
+        {
+            m_job();
+        }
+
+    private:
+        std::function<void()> m_job;
+    };
+}
+
+struct TxRowBuilder::Batch
+{
+    ChangeAction action = ChangeAction::Reset;
+    std::vector<TxDescription> transactions;
+    Currency secondCurrency = Currency::UNKNOWN();
+
+    // filled by the workers, each one writes its own range only
+    std::vector<std::optional<TxRow>> rows;
+    std::atomic<size_t> chunksLeft{0};
+
+    // UI thread only
+    bool done = false;
+
+    void build(size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            try
+            {
+                rows[i].emplace(transactions[i], secondCurrency);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING() << "Failed to build transaction row: " << e.what();
+            }
+        }
+    }
+};
+
+TxRowBuilder::TxRowBuilder(QObject* parent)
+    : QObject(parent)
+    , m_owner(std::make_shared<Owner>())
+{
+    m_owner->builder = this;
+}
+
+TxRowBuilder::~TxRowBuilder()
+{
+    // running chunks finish on their own, their results are dropped
+    std::lock_guard<std::mutex> lock(m_owner->mutex);
+    m_owner->builder = nullptr;
+}
+
+void TxRowBuilder::post(ChangeAction action, std::vector<TxDescription> transactions, const Currency& secondCurrency)
+{
+    const auto id = m_nextId++;
+    if (action == ChangeAction::Reset)
+    {
+        // nothing posted before a reset matters anymore
+        m_pending.clear();
+        m_nextToEmit = id;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->action = action;
+    batch->transactions = std::move(transactions);
+    batch->secondCurrency = secondCurrency;
+    batch->rows.resize(batch->transactions.size());
+    m_pending.emplace(id, batch);
+
+    const auto count = batch->transactions.size();
+    if (count <= kInlineRows)
+    {
+        batch->build(0, count);
+        batch->done = true;
+        flush();
+        return;
+    }
+
+    auto pool = QThreadPool::globalInstance();
+    const auto threads = static_cast<size_t>(std::max(1, pool->maxThreadCount()));
+    const auto chunk = std::max(kMinChunkRows, (count + threads - 1) / threads);
+    batch->chunksLeft = (count + chunk - 1) / chunk;
+
+    for (size_t first = 0; first < count; first += chunk)
+    {
+        const auto last = std::min(count, first + chunk);
+        pool->start(new Job([owner = m_owner, batch, id, first, last]()
+        {
+            batch->build(first, last);
+            if (--batch->chunksLeft != 0)
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(owner->mutex);
+            if (auto builder = owner->builder)
+            {
+                QMetaObject::invokeMethod(builder, [builder, id]() { builder->onBatchDone(id); }, Qt::QueuedConnection);
+            }
+        }));
+    }
+}
+
+void TxRowBuilder::onBatchDone(uint64_t id)
+{
+    auto it = m_pending.find(id);
+    if (it == m_pending.end())
+    {
+        // superseded by a reset
+        return;
+    }
+
+    it->second->done = true;
+    flush();
+}
+
+void TxRowBuilder::flush()
+{
+    for (auto it = m_pending.find(m_nextToEmit); it != m_pending.end() && it->second->done; it = m_pending.find(m_nextToEmit))
+    {
+        auto batch = std::move(it->second);
+        m_pending.erase(it);
+        ++m_nextToEmit;
+
+        std::vector<TxRow> rows;
+        rows.reserve(batch->rows.size());
+        for (auto& row : batch->rows)
+        {
+            if (row)
+            {
+                rows.push_back(std::move(*row));
+            }
+        }
+
+        emit rowsBuilt(batch->action, rows);
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "tx_row.h"
+
+//
+// Builds TxRows off the UI thread. Each posted batch is split into chunks run on the global
+// thread pool, finished batches are handed back on the UI thread strictly in posting order.
+// Batches posted before a reset are dropped once the reset is posted
+//
+class TxRowBuilder : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TxRowBuilder(QObject* parent = nullptr);
+    ~TxRowBuilder() override;
+
+    void post(beam::wallet::ChangeAction action, std::vector<beam::wallet::TxDescription> transactions, const beam::wallet::Currency& secondCurrency);
+
+signals:
+    void rowsBuilt(beam::wallet::ChangeAction action, const std::vector<TxRow>& rows);
+
+private:
+    struct Batch;
+
+    // lets workers reach the builder only while it is alive
+    struct Owner
+    {
+        std::mutex mutex;
+        TxRowBuilder* builder = nullptr;
+    };
+
+    void onBatchDone(uint64_t id);
+    void flush();
+
+    std::shared_ptr<Owner> m_owner;
+    std::map<uint64_t, std::shared_ptr<Batch>> m_pending;
+    uint64_t m_nextId = 0;
+    uint64_t m_nextToEmit = 0;
+};
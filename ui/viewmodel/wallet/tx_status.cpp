@@ -0,0 +1,218 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_status.h"
+#include <unordered_map>
+
+namespace
+{
+    using Kind = TxStatusKind;
+    using Mod = TxStatusModifier;
+
+    size_t indexOf(TxStatusCode code)
+    {
+        return static_cast<size_t>(code.toInt());
+    }
+}
+
+TxStatusCode parseTxStatus(const std::string& status, beam::wallet::TxAddressType addressType)
+{
+    static const std::unordered_map<std::string, TxStatusCode> kStatuses =
+    {
+        { "pending",                                    { Kind::Pending,         Mod::None } },
+        { "waiting for sender",                         { Kind::WaitingSender,   Mod::None } },
+        { "waiting for receiver",                       { Kind::WaitingReceiver, Mod::None } },
+        { "in progress",                                { Kind::InProgress,      Mod::None } },
+        { "sent to own address",                        { Kind::SentToOwn,       Mod::None } },
+        { "sending to own address",                     { Kind::SendingToOwn,    Mod::None } },
+        { "received",                                   { Kind::Received,        Mod::None } },
+        { "sent",                                       { Kind::Sent,            Mod::None } },
+        { "cancelled",                                  { Kind::Canceled,        Mod::None } },
+        { "expired",                                    { Kind::Expired,         Mod::None } },
+        { "failed",                                     { Kind::Failed,          Mod::None } },
+        { "completed",                                  { Kind::Completed,       Mod::None } },
+        { "confirming",                                 { Kind::Confirming,      Mod::None } },
+        { "in progress maximum anonymity",              { Kind::InProgress,      Mod::MaxPrivacy } },
+        { "in progress offline",                        { Kind::InProgress,      Mod::Offline } },
+        { "in progress public offline",                 { Kind::InProgress,      Mod::PublicOffline } },
+        { "sending maximum anonymity to own address",   { Kind::SendingToOwn,    Mod::MaxPrivacy } },
+        { "sending offline to own address",             { Kind::SendingToOwn,    Mod::Offline } },
+        { "sending public offline to own address",      { Kind::SendingToOwn,    Mod::PublicOffline } },
+        { "sent maximum anonymity",                     { Kind::Sent,            Mod::MaxPrivacy } },
+        { "sent offline",                               { Kind::Sent,            Mod::Offline } },
+        { "sent public offline",                        { Kind::Sent,            Mod::PublicOffline } },
+        { "sent maximum anonymity to own address",      { Kind::SentToOwn,       Mod::MaxPrivacy } },
+        { "sent offline to own address",                { Kind::SentToOwn,       Mod::Offline } },
+        { "sent public offline to own address",         { Kind::SentToOwn,       Mod::PublicOffline } },
+        { "received maximum anonymity",                 { Kind::Received,        Mod::MaxPrivacy } },
+        { "received offline",                           { Kind::Received,        Mod::Offline } },
+        { "received public offline",                    { Kind::Received,        Mod::PublicOffline } },
+        { "canceled maximum anonymity",                 { Kind::Canceled,        Mod::MaxPrivacy } },
+        { "canceled offline",                           { Kind::Canceled,        Mod::Offline } },
+        { "canceled public offline",                    { Kind::Canceled,        Mod::PublicOffline } },
+        { "failed maximum anonymity",                   { Kind::Failed,          Mod::MaxPrivacy } },
+        { "failed offline",                             { Kind::Failed,          Mod::Offline } },
+        { "failed public offline",                      { Kind::Failed,          Mod::PublicOffline } }
+    };
+
+    auto it = kStatuses.find(status);
+    if (it == kStatuses.end())
+    {
+        return TxStatusCode();
+    }
+
+    auto code = it->second;
+    if (code.kind == Kind::WaitingReceiver && addressType == beam::wallet::TxAddressType::Offline)
+    {
+        code.modifier = Mod::Offline;
+    }
+    return code;
+}
+
+TxStatusCode parseSwapTxStatus(const std::string& status)
+{
+    static const std::unordered_map<std::string, TxStatusKind> kStatuses =
+    {
+        { "pending",     Kind::Pending },
+        { "in progress", Kind::InProgress },
+        { "completed",   Kind::Completed },
+        { "canceled",    Kind::Canceled },
+        { "expired",     Kind::Expired },
+        { "failing",     Kind::Failing },
+        { "failed",      Kind::Failed }
+    };
+
+    auto it = kStatuses.find(status);
+    return { it != kStatuses.end() ? it->second : Kind::Unknown, Mod::None };
+}
+
+TxStatusTexts::TxStatusTexts()
+{
+    rebuild();
+}
+
+void TxStatusTexts::rebuild()
+{
+    //% "unknown"
+    m_texts.fill(qtTrId("wallet-txs-status-unknown"));
+
+    auto set = [this](Kind kind, Mod modifier, QString text)
+    {
+        m_texts[indexOf({kind, modifier})] = std::move(text);
+    };
+
+    //% "pending"
+    set(Kind::Pending, Mod::None, qtTrId("wallet-txs-status-pending"));
+    //% "waiting for sender"
+    set(Kind::WaitingSender, Mod::None, qtTrId("wallet-txs-status-waiting-sender"));
+    //% "waiting for receiver"
+    set(Kind::WaitingReceiver, Mod::None, qtTrId("wallet-txs-status-waiting-receiver"));
+    /*% "waiting for receiver
+(offline)"*/
+    set(Kind::WaitingReceiver, Mod::Offline, qtTrId("wallet-txs-status-waiting-receiver-offline"));
+    //% "sent to own address"
+    set(Kind::SentToOwn, Mod::None, qtTrId("wallet-txs-status-own-sent"));
+    //% "sending to own address"
+    set(Kind::SendingToOwn, Mod::None, qtTrId("wallet-txs-status-own-sending"));
+    //% "received"
+    set(Kind::Received, Mod::None, qtTrId("wallet-txs-status-received"));
+    //% "sent"
+    set(Kind::Sent, Mod::None, qtTrId("wallet-txs-status-sent"));
+    //% "canceled"
+    set(Kind::Canceled, Mod::None, qtTrId("wallet-txs-status-cancelled"));
+    //% "expired"
+    set(Kind::Expired, Mod::None, qtTrId("wallet-txs-status-expired"));
+    //% "failing"
+    set(Kind::Failing, Mod::None, qtTrId("wallet-txs-status-failing"));
+    //% "failed"
+    set(Kind::Failed, Mod::None, qtTrId("wallet-txs-status-failed"));
+    //% "completed"
+    set(Kind::Completed, Mod::None, qtTrId("wallet-txs-status-completed"));
+    //% "confirming"
+    set(Kind::Confirming, Mod::None, qtTrId("wallet-txs-status-confirming"));
+
+    // in progress
+    //% "in progress"
+    set(Kind::InProgress, Mod::None, qtTrId("wallet-txs-status-in-progress"));
+    /*% "in progress
+(maximum anonymity)" */
+    set(Kind::InProgress, Mod::MaxPrivacy, qtTrId("wallet-txs-status-in-progress-max"));
+    /*% "in progress (offline)" */
+    set(Kind::InProgress, Mod::Offline, qtTrId("wallet-txs-status-in-progress-max-offline"));
+    /*% "in progress
+(public offline)" */
+    set(Kind::InProgress, Mod::PublicOffline, qtTrId("wallet-txs-status-in-progress-public-offline"));
+    /*% "sending to own address
+(maximum anonymity)" */
+    set(Kind::SendingToOwn, Mod::MaxPrivacy, qtTrId("wallet-txs-status-in-progress-max-to-own"));
+    /*% "sending to own address
+(offline)" */
+    set(Kind::SendingToOwn, Mod::Offline, qtTrId("wallet-txs-status-in-progress-offline-to-own"));
+    /*% "sending to own address
+(public offline)" */
+    set(Kind::SendingToOwn, Mod::PublicOffline, qtTrId("wallet-txs-status-in-progress-pub-offline-to-own"));
+
+    // sent
+    /*% "sent
+(maximum anonymity)"*/
+    set(Kind::Sent, Mod::MaxPrivacy, qtTrId("wallet-txs-status-sent-max"));
+    /*% "sent (offline)" */
+    set(Kind::Sent, Mod::Offline, qtTrId("wallet-txs-status-sent-max-offline"));
+    /*% "sent
+(public offline)" */
+    set(Kind::Sent, Mod::PublicOffline, qtTrId("wallet-txs-status-sent-public-offline"));
+    /*% "sent to own address
+(maximum anonymity)" */
+    set(Kind::SentToOwn, Mod::MaxPrivacy, qtTrId("wallet-txs-status-sent-max-to-own"));
+    /*% "sent to own address
+(offline)" */
+    set(Kind::SentToOwn, Mod::Offline, qtTrId("wallet-txs-status-sent-offline-to-own"));
+    /*% "sent to own address
+(public offline)" */
+    set(Kind::SentToOwn, Mod::PublicOffline, qtTrId("wallet-txs-status-sent-pub-offline-to-own"));
+
+    // received
+    /*% "received
+(maximum anonymity)" */
+    set(Kind::Received, Mod::MaxPrivacy, qtTrId("wallet-txs-status-received-max"));
+    /*% "received (offline)" */
+    set(Kind::Received, Mod::Offline, qtTrId("wallet-txs-status-received-max-offline"));
+    /*% "received
+(public offline)" */
+    set(Kind::Received, Mod::PublicOffline, qtTrId("wallet-txs-status-received-public-offline"));
+
+    // canceled
+    /*% "canceled
+(maximum anonymity)" */
+    set(Kind::Canceled, Mod::MaxPrivacy, qtTrId("wallet-txs-status-canceled-max"));
+    /*% "canceled (offline)" */
+    set(Kind::Canceled, Mod::Offline, qtTrId("wallet-txs-status-canceled-max-offline"));
+    /*% "canceled
+(public offline)" */
+    set(Kind::Canceled, Mod::PublicOffline, qtTrId("wallet-txs-status-canceled-public-offline"));
+
+    // failed
+    /*% "failed
+(maximum anonymity)" */
+    set(Kind::Failed, Mod::MaxPrivacy, qtTrId("wallet-txs-status-failed-max"));
+    /*% "failed (offline)" */
+    set(Kind::Failed, Mod::Offline, qtTrId("wallet-txs-status-failed-max-offline"));
+    /*% "failed
+(public offline)" */
+    set(Kind::Failed, Mod::PublicOffline, qtTrId("wallet-txs-status-failed-public-offline"));
+}
+
+const QString& TxStatusTexts::get(TxStatusCode code) const
+{
+    return m_texts[indexOf(code)];
+}
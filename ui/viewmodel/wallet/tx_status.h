@@ -0,0 +1,93 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <array>
+#include <string>
+#include "wallet/core/common.h"
+
+//
+// Transaction status as shown in the UI. The wallet interprets status as an English phrase,
+// it is parsed once when the row is built and after that only the compact code travels around
+//
+enum class TxStatusKind : uint8_t
+{
+    Unknown,
+    Pending,
+    WaitingSender,
+    WaitingReceiver,
+    InProgress,
+    SendingToOwn,
+    Confirming,
+    Sent,
+    SentToOwn,
+    Received,
+    Completed,
+    Canceled,
+    Expired,
+    Failing,
+    Failed,
+    Count
+};
+
+enum class TxStatusModifier : uint8_t
+{
+    None,
+    MaxPrivacy,
+    Offline,
+    PublicOffline,
+    Count
+};
+
+struct TxStatusCode
+{
+    TxStatusKind kind = TxStatusKind::Unknown;
+    TxStatusModifier modifier = TxStatusModifier::None;
+
+    // lifecycle order, used as the sort key
+    int toInt() const
+    {
+        return static_cast<int>(kind) * static_cast<int>(TxStatusModifier::Count) + static_cast<int>(modifier);
+    }
+
+    bool operator==(const TxStatusCode& other) const
+    {
+        return kind == other.kind && modifier == other.modifier;
+    }
+
+    bool operator!=(const TxStatusCode& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+TxStatusCode parseTxStatus(const std::string& status, beam::wallet::TxAddressType addressType);
+TxStatusCode parseSwapTxStatus(const std::string& status);
+
+//
+// Translated status texts, one per code. Rebuilt on locale change, lookups are plain indexing
+//
+class TxStatusTexts
+{
+public:
+    TxStatusTexts();
+
+    void rebuild();
+    const QString& get(TxStatusCode code) const;
+
+private:
+    static constexpr size_t kCount = static_cast<size_t>(TxStatusKind::Count) * static_cast<size_t>(TxStatusModifier::Count);
+    std::array<QString, kCount> m_texts;
+};
@@ -18,6 +18,8 @@
 #include <QTextStream>
 #include <QTextCodec>
 #include <vector>
+#include <algorithm>
+#include <iterator>
 #include "model/app_model.h"
 
 namespace
@@ -25,24 +27,61 @@ namespace
     const char kTxHistoryFileNamePrefix[] = "transactions_history_";
     const char kTxHistoryFileFormatDesc[] = "Comma-Separated Values (*.csv)";
     const char kTxHistoryFileNameFormat[] = "yyyy_MM_dd_HH_mm_ss";
+
+    bool isTableTransaction(const beam::wallet::TxDescription& tx)
+    {
+        using namespace beam::wallet;
+        if(const auto txType = tx.GetParameter<TxType>(TxParameterID::TransactionType))
+        {
+            switch(*txType)
+            {
+            case TxType::AtomicSwap:
+            case TxType::AssetIssue:
+            case TxType::AssetConsume:
+            case TxType::AssetReg:
+            case TxType::AssetUnreg:
+            case TxType::AssetInfo:
+            case TxType::PullTransaction:
+            case TxType::UnlinkFunds:
+            case TxType::VoucherRequest:
+            case TxType::VoucherResponse:
+                return false;
+
+            case TxType::ALL:
+                assert(!"This should not happen");
+                return false;
+
+            case TxType::Contract:
+            case TxType::PushTransaction:
+            case TxType::Simple:
+            case TxType::DexSimpleSwap:
+                return true;
+            }
+        }
+        return false;
+    }
 }
 
 TxTableViewModel::TxTableViewModel()
     : _model(AppModel::getInstance().getWalletModel())
     , _rates(AppModel::getInstance().getRates())
     , _settings{AppModel::getInstance().getSettings()}
+    , _transactions(AppModel::getInstance().getTransactions())
 {
-    connect(_model.get(), SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)), SLOT(onTransactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
+    connect(_transactions.get(), &TransactionsStore::transactionsChanged, this, &TxTableViewModel::onTransactionsChanged);
+    connect(&_rowBuilder, &TxRowBuilder::rowsBuilt, this, &TxTableViewModel::onRowsBuilt);
     connect(_model.get(), SIGNAL(txHistoryExportedToCsv(const QString&)), this, SLOT(onTxHistoryExportedToCsv(const QString&)));
     connect(_rates.get(), &ExchangeRatesManager::rateUnitChanged, this, &TxTableViewModel::rateChanged);
     connect(_rates.get(), &ExchangeRatesManager::activeRateChanged, this, &TxTableViewModel::rateChanged);
+    connect(&_transactionsFilter, &TxFilterModel::activeCountChanged, this, &TxTableViewModel::activeCountChanged);
 
     _showInProgress = _settings.getShowInProgress();
     _showCompleted = _settings.getShowCompleted();
     _showCanceled = _settings.getShowCanceled();
     _showFailed = _settings.getShowFailed();
+    updateStatusFilter();
 
-    _model->getAsync()->getTransactions();
+    _transactions->isLoaded() ? reloadTransactions() : _transactions->load();
 }
 
 void TxTableViewModel::exportTxHistoryToCsv()
@@ -81,90 +120,53 @@ void TxTableViewModel::onTxHistoryExportedToCsv(const QString& data)
 
 QAbstractItemModel* TxTableViewModel::getTransactions()
 {
-    return &_transactionsList;
+    return &_transactionsFilter;
 }
 
 void TxTableViewModel::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
 {
     using namespace beam::wallet;
 
-    std::vector<std::shared_ptr<TxObject>> modifiedTransactions;
-    modifiedTransactions.reserve(transactions.size());
-    const auto secondCurrency = _rates->getRateCurrency();
-
-    for (const auto& t : transactions)
-    {
-        if(const auto txType = t.GetParameter<TxType>(TxParameterID::TransactionType))
-        {
-            switch(*txType)
-            {
-            case TxType::AtomicSwap:
-            case TxType::AssetIssue:
-            case TxType::AssetConsume:
-            case TxType::AssetReg:
-            case TxType::AssetUnreg:
-            case TxType::AssetInfo:
-            case TxType::PullTransaction:
-            case TxType::UnlinkFunds:
-            case TxType::VoucherRequest:
-            case TxType::VoucherResponse:
-                continue;
+    std::vector<TxDescription> tableTransactions;
+    tableTransactions.reserve(transactions.size());
+    std::copy_if(transactions.begin(), transactions.end(), std::back_inserter(tableTransactions), isTableTransaction);
 
-            case TxType::ALL:
-                assert(!"This should not happen");
-                continue;
+    // rows are built on the pool, onRowsBuilt gets them back in the same order
+    _rowBuilder.post(action, std::move(tableTransactions), _rates->getRateCurrency());
+}
 
-            case TxType::Contract:
-            case TxType::PushTransaction:
-            case TxType::Simple:
-            case TxType::DexSimpleSwap:
-                modifiedTransactions.push_back(std::make_shared<TxObject>(t, secondCurrency));
-                break;
-            }
-        }
-    }
+void TxTableViewModel::onRowsBuilt(beam::wallet::ChangeAction action, const std::vector<TxRow>& rows)
+{
+    using namespace beam::wallet;
 
-    switch (action)
+    if (action == ChangeAction::Reset)
     {
-        case ChangeAction::Reset:
-            {
-                std::vector<std::shared_ptr<TxObject>> modifiedTransactionsFiltered;
-                modifiedTransactionsFiltered.reserve(modifiedTransactions.size());
-                for (const auto& tx: modifiedTransactions)
-                {
-                    if (!_showInProgress && tx->isInProgress())
-                        continue;
-
-                    if (!_showCompleted && tx->isCompleted())
-                        continue;
+        _transactionsList.resetHistory(rows, _loadAll);
 
-                    if (!_showCanceled && tx->isCanceled())
-                        continue;
+        emit transactionsChanged();
+        return;
+    }
 
-                    if (!_showFailed && tx->isFailed())
-                        continue;
-
-                    modifiedTransactionsFiltered.push_back(tx);
-                }
-                _transactionsList.reset(modifiedTransactionsFiltered);
-                break;
-            }
+    // rows touched here are shown right away, the history must not bring back the older state
+    _transactionsList.dropHistory(rows);
 
+    switch (action)
+    {
         case ChangeAction::Removed:
             {
-                _transactionsList.remove(modifiedTransactions);
+                _transactionsList.remove(rows);
                 break;
             }
 
         case ChangeAction::Added:
             {
-                _transactionsList.insert(modifiedTransactions);
+                _transactionsList.insert(rows);
                 break;
             }
 
         case ChangeAction::Updated:
             {
-                _transactionsList.update(modifiedTransactions);
+                _transactionsList.update(rows);
                 break;
             }
 
@@ -176,6 +178,43 @@ void TxTableViewModel::onTransactionsChanged(beam::wallet::ChangeAction action,
     emit transactionsChanged();
 }
 
+void TxTableViewModel::reloadTransactions()
+{
+    onTransactionsChanged(beam::wallet::ChangeAction::Reset, _transactions->getTransactions());
+}
+
+void TxTableViewModel::updateStatusFilter()
+{
+    uint32_t hidden = 0;
+    if (!_showInProgress) hidden |= TxFilterModel::InProgress;
+    if (!_showCompleted)  hidden |= TxFilterModel::Completed;
+    if (!_showCanceled)   hidden |= TxFilterModel::Canceled;
+    if (!_showFailed)     hidden |= TxFilterModel::Failed;
+
+    uint32_t required = 0;
+    switch (_kindFilter)
+    {
+    case InProgressKind: required = TxFilterModel::InProgress; break;
+    case SentKind:       required = TxFilterModel::Sent; break;
+    case ReceivedKind:   required = TxFilterModel::Received; break;
+    default: break;
+    }
+
+    _transactionsFilter.setStatuses(hidden, required);
+
+    // hidden statuses would leave the first page short
+    if (hidden || required)
+    {
+        loadAllTransactions();
+    }
+}
+
+void TxTableViewModel::loadAllTransactions()
+{
+    _loadAll = true;
+    _transactionsList.fetchAll();
+}
+
 QString TxTableViewModel::getRateUnit() const
 {
     return beamui::getCurrencyUnitName(_rates->getRateCurrency());
@@ -197,7 +236,7 @@ void TxTableViewModel::setShowInProgress(bool value)
     _showInProgress = value;
     _settings.setShowInProgress(value);
     emit showInProgressChanged();
-    _model->getAsync()->getTransactions();
+    updateStatusFilter();
 }
 
 bool TxTableViewModel::getShowCompleted() const
@@ -210,7 +249,7 @@ void TxTableViewModel::setShowCompleted(bool value)
     _showCompleted = value;
     _settings.setShowCompleted(value);
     emit showCompletedChanged();
-    _model->getAsync()->getTransactions();
+    updateStatusFilter();
 }
 
 bool TxTableViewModel::getShowCanceled() const
@@ -223,7 +262,7 @@ void TxTableViewModel::setShowCanceled(bool value)
     _showCanceled = value;
     _settings.setShowCanceled(value);
     emit showCanceledChanged();
-    _model->getAsync()->getTransactions();
+    updateStatusFilter();
 }
 
 bool TxTableViewModel::getShowFailed() const
@@ -236,7 +275,93 @@ void TxTableViewModel::setShowFailed(bool value)
     _showFailed = value;
     _settings.setShowFailed(value);
     emit showFailedCanged();
-    _model->getAsync()->getTransactions();
+    updateStatusFilter();
+}
+
+int TxTableViewModel::getKindFilter() const
+{
+    return _kindFilter;
+}
+
+void TxTableViewModel::setKindFilter(int value)
+{
+    if (_kindFilter != value)
+    {
+        _kindFilter = value;
+        emit kindFilterChanged();
+        updateStatusFilter();
+    }
+}
+
+QString TxTableViewModel::getSearchFilter() const
+{
+    return _searchFilter;
+}
+
+void TxTableViewModel::setSearchFilter(const QString& value)
+{
+    if (_searchFilter != value)
+    {
+        _searchFilter = value;
+        emit searchFilterChanged();
+        _transactionsFilter.setSearchText(value);
+    }
+}
+
+QString TxTableViewModel::getDappFilter() const
+{
+    return _dappFilter;
+}
+
+void TxTableViewModel::setDappFilter(const QString& value)
+{
+    if (_dappFilter != value)
+    {
+        _dappFilter = value;
+        emit dappFilterChanged();
+
+        // "all" stands for any application transaction
+        const bool all = value == "all";
+        _transactionsFilter.setDapp(all, all ? QString() : value);
+
+        // the filter runs over the loaded rows only
+        if (!value.isEmpty())
+        {
+            loadAllTransactions();
+        }
+    }
+}
+
+QVariantList TxTableViewModel::getAssetFilter() const
+{
+    return _assetFilter;
+}
+
+void TxTableViewModel::setAssetFilter(const QVariantList& value)
+{
+    if (_assetFilter != value)
+    {
+        _assetFilter = value;
+        emit assetFilterChanged();
+
+        std::vector<beam::Asset::ID> assets;
+        assets.reserve(value.size());
+        for (const auto& id : value)
+        {
+            assets.push_back(id.toUInt());
+        }
+        _transactionsFilter.setAssets(std::move(assets));
+
+        if (!value.isEmpty())
+        {
+            loadAllTransactions();
+        }
+    }
+}
+
+int TxTableViewModel::getActiveCount() const
+{
+    return _transactionsFilter.getActiveCount();
 }
 
 void TxTableViewModel::cancelTx(const QVariant& variantTxID)
@@ -18,8 +18,11 @@
 #include <QAbstractItemModel>
 #include "model/wallet_model.h"
 #include "tx_object_list.h"
+#include "tx_filter_model.h"
+#include "tx_row_builder.h"
 #include "model/exchange_rates_manager.h"
 #include "model/settings.h"
+#include "model/transactions_store.h"
 
 class TxTableViewModel: public QObject {
     Q_OBJECT
@@ -29,8 +32,22 @@ class TxTableViewModel: public QObject {
     Q_PROPERTY(bool showCompleted   READ getShowCompleted  WRITE setShowCompleted  NOTIFY showCompletedChanged)
     Q_PROPERTY(bool showCanceled    READ getShowCanceled   WRITE setShowCanceled   NOTIFY showCanceledChanged)
     Q_PROPERTY(bool showFailed      READ getShowFailed     WRITE setShowFailed     NOTIFY showFailedCanged)
+    Q_PROPERTY(int kindFilter       READ getKindFilter     WRITE setKindFilter     NOTIFY kindFilterChanged)
+    Q_PROPERTY(QString searchFilter READ getSearchFilter   WRITE setSearchFilter   NOTIFY searchFilterChanged)
+    Q_PROPERTY(QString dappFilter   READ getDappFilter     WRITE setDappFilter     NOTIFY dappFilterChanged)
+    Q_PROPERTY(QVariantList assetFilter READ getAssetFilter  WRITE setAssetFilter    NOTIFY assetFilterChanged)
+    Q_PROPERTY(int activeCount      READ getActiveCount    NOTIFY activeCountChanged)
 
 public:
+    enum Kind
+    {
+        AllKind,
+        InProgressKind,
+        SentKind,
+        ReceivedKind
+    };
+    Q_ENUM(Kind)
+
     TxTableViewModel();
     ~TxTableViewModel() override = default;
 
@@ -46,8 +63,18 @@ public:
     void setShowCanceled(bool value);
     bool getShowFailed() const;
     void setShowFailed(bool value);
+    int getKindFilter() const;
+    void setKindFilter(int value);
+    QString getSearchFilter() const;
+    void setSearchFilter(const QString& value);
+    QString getDappFilter() const;
+    void setDappFilter(const QString& value);
+    QVariantList getAssetFilter() const;
+    void setAssetFilter(const QVariantList& value);
+    int getActiveCount() const;
 
     Q_INVOKABLE void exportTxHistoryToCsv();
+    Q_INVOKABLE void loadAllTransactions();
     Q_INVOKABLE void cancelTx(const QVariant& variantTxID);
     Q_INVOKABLE void deleteTx(const QVariant& variantTxID);
     Q_INVOKABLE PaymentInfoItem* getPaymentInfo(const QVariant& variantTxID);
@@ -63,16 +90,33 @@ signals:
     void showCompletedChanged();
     void showCanceledChanged();
     void showFailedCanged();
+    void kindFilterChanged();
+    void searchFilterChanged();
+    void dappFilterChanged();
+    void assetFilterChanged();
+    void activeCountChanged();
 
 private:
+    void reloadTransactions();
+    void onRowsBuilt(beam::wallet::ChangeAction action, const std::vector<TxRow>& rows);
+    void updateStatusFilter();
+
     WalletModel::Ptr     _model;
     QQueue<QString>      _txHistoryToCsvPaths;
     TxObjectList         _transactionsList;
+    TxFilterModel        _transactionsFilter{_transactionsList};
+    TxRowBuilder         _rowBuilder;
     ExchangeRatesManager::Ptr _rates;
     WalletSettings&      _settings;
+    TransactionsStore::Ptr _transactions;
 
     bool _showInProgress = true;
     bool _showCompleted = true;
     bool _showCanceled = true;
     bool _showFailed = true;
+    int _kindFilter = AllKind;
+    QString _searchFilter;
+    QString _dappFilter;
+    QVariantList _assetFilter;
+    bool _loadAll = false;  // some filter or sort needed the whole history, reloads keep it
 };